@@ -0,0 +1,196 @@
+//decoder benchmark: decodes every image of the corpus (bench/make_corpus.py) with img_parse and reports
+//ns/pixel, heap allocations (count, bytes, peak live bytes, largest request) and whether the output matches the expected one
+//with stb_image.h on the include path the same files are decoded by stb_image too, as a reference for output and speed
+//afterwards the UART encoder is timed for a few display sizes (ns/LED, against the line time of the frame)
+//usage: pixelbox_bench [corpus folder] [minimal time per file in ms]
+
+#include <Arduino.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <dirent.h>
+
+#include "alloc.hpp"
+#include "png_parse.hpp"
+#include "gif_parse.hpp"
+#include "ws2812b_encoder.hpp"
+
+#if __has_include(<stb_image.h>)
+#define BENCH_STB_IMAGE
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#elif __has_include(<stb/stb_image.h>)
+#define BENCH_STB_IMAGE
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+#endif
+
+typedef struct result_s
+{
+  bool ok;
+  uint32_t pixels;  //decoded pixels, every frame counted
+  std::vector<uint8_t> output;
+} result_s;
+
+bool read_file(const std::string& path, std::vector<uint8_t>& data)
+{
+  FILE* f = fopen(path.c_str(), "rb");
+  if(f == NULL) return false;
+  uint8_t buf[4096];
+  size_t len;
+  while((len = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + len);
+  fclose(f);
+  return true;
+}
+
+void decode_png(std::vector<uint8_t>& data, result_s& result, bool keep_output)
+{
+  img_parse::png_parse_context_s ctx;
+  result.pixels = 0;
+  result.ok = img_parse::init(ctx, data.data(), data.size()) && img_parse::parse(ctx);
+  if(result.ok)
+  {
+    result.pixels = ctx.hdr.width * ctx.hdr.height;
+    if(keep_output) result.output.assign(ctx.unfiltered_data, ctx.unfiltered_data + result.pixels * ctx.pixel_size);
+  }
+  img_parse::deinit(ctx);
+}
+
+void decode_gif(std::vector<uint8_t>& data, result_s& result, bool keep_output)
+{
+  img_parse::gif_parse_context_s ctx;
+  result.pixels = 0;
+  result.ok = img_parse::init(ctx, data.data(), data.size()) == img_parse::error_code_ok && img_parse::parse(ctx) == img_parse::error_code_ok;
+  if(result.ok)
+  {
+    for(uint32_t i = 0; i < ctx.images_size; i++)
+    {
+      result.pixels += ctx.images[i].output_size;
+      if(keep_output) result.output.insert(result.output.end(), (uint8_t*)ctx.images[i].output, (uint8_t*)(ctx.images[i].output + ctx.images[i].output_size));
+    }
+  }
+  img_parse::deinit(ctx);
+}
+
+#ifdef BENCH_STB_IMAGE
+void decode_stb(std::vector<uint8_t>& data, bool gif, uint32_t channels, result_s& result, bool keep_output)
+{
+  int width, height, frames = 1, components;
+  int* delays = NULL;
+  result.pixels = 0;
+  uint8_t* pixels = gif ? stbi_load_gif_from_memory(data.data(), data.size(), &delays, &width, &height, &frames, &components, channels)
+                        : stbi_load_from_memory(data.data(), data.size(), &width, &height, &components, channels);
+  result.ok = pixels != NULL;
+  if(result.ok)
+  {
+    result.pixels = width * height * frames;
+    if(keep_output) result.output.assign(pixels, pixels + result.pixels * channels);
+  }
+  stbi_image_free(pixels);
+  stbi_image_free(delays);
+}
+#endif
+
+template<typename F> double measure_ns(F decode, uint32_t min_ms)
+{
+  //the fastest of several runs, at least min_ms long altogether
+  double best = 0;
+  uint64_t total_ns = 0;
+  for(uint32_t runs = 0; runs < 5 || total_ns < (uint64_t)min_ms * 1000000; runs++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    decode();
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    if(runs == 0 || ns < best) best = ns;
+    total_ns += ns;
+  }
+  return best;
+}
+
+void bench_encoder(uint32_t min_ms)
+{
+  printf("%-34s %8s %9s %9s %9s\n", "encoder", "LEDs", "ns/LED", "us/frame", "line us");
+  for(uint32_t led_count : {64u, 256u, 1024u})
+  {
+    std::vector<uint8_t> rgb(led_count * 3), symbols(pixelbox::ws2812b_encoder::encoded_size(led_count));
+    for(uint32_t i = 0; i < rgb.size(); i++) rgb[i] = i * 37;
+    double ns = measure_ns([&]() { pixelbox::ws2812b_encoder::encode(rgb.data(), led_count, 200, symbols.data()); }, min_ms);
+    printf("%-34s %8u %9.2f %9.2f %9u\n", "ws2812b_encoder::encode", led_count, ns / led_count, ns / 1000, pixelbox::ws2812b_encoder::frame_time_us(led_count));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::string dir_corpus = argc > 1 ? argv[1] : "bench/corpus";
+  uint32_t min_ms = argc > 2 ? atoi(argv[2]) : 50;
+
+  std::vector<std::string> names;
+  DIR* dir = opendir(dir_corpus.c_str());
+  if(dir == NULL)
+  {
+    fprintf(stderr, "%s: no corpus, run bench/make_corpus.py first\n", dir_corpus.c_str());
+    return 1;
+  }
+  for(struct dirent* entry = readdir(dir); entry != NULL; entry = readdir(dir))
+  {
+    std::string name = entry->d_name;
+    if(name.size() > 4 && (name.compare(name.size() - 4, 4, ".png") == 0 || name.compare(name.size() - 4, 4, ".gif") == 0)) names.push_back(name);
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+
+  printf("%-34s %8s %9s %7s %9s %9s %9s %6s", "file", "pixels", "ns/pixel", "allocs", "bytes", "peak", "largest", "output");
+#ifdef BENCH_STB_IMAGE
+  printf(" %9s %6s", "stb ns/px", "stb");
+#endif
+  printf("\n");
+
+  int result_code = 0;
+  double total_ns[2] = {0, 0};
+  uint64_t total_pixels[2] = {0, 0};
+  for(const std::string& name : names)
+  {
+    std::vector<uint8_t> data, expected;
+    bool gif = name.compare(name.size() - 4, 4, ".gif") == 0;
+    if(!read_file(dir_corpus + "/" + name, data) || !read_file(dir_corpus + "/" + name + ".raw", expected))
+    {
+      fprintf(stderr, "%s: can't read\n", name.c_str());
+      result_code = 1;
+      continue;
+    }
+
+    //one run with the heap accounted (the parsers' allocator hooks) and the output kept for the check, then the timed runs
+    result_s result;
+    uint32_t measurement = pixelbox::alloc::begin();
+    if(gif) decode_gif(data, result, true);
+    else decode_png(data, result, true);
+    pixelbox::alloc::end(measurement);
+    pixelbox::alloc::stats_s alloc_stats = pixelbox::alloc::last();
+    bool output_ok = result.ok && result.output == expected;
+    if(!output_ok) result_code = 1;
+
+    result_s timed;
+    double ns = measure_ns([&]() { if(gif) decode_gif(data, timed, false); else decode_png(data, timed, false); }, min_ms);
+    double ns_pixel = result.pixels ? ns / result.pixels : 0;
+    total_ns[gif] += ns;
+    total_pixels[gif] += result.pixels;
+
+    printf("%-34s %8u %9.2f %7u %9u %9u %9u %6s", name.c_str(), result.pixels, ns_pixel, alloc_stats.calls,
+           alloc_stats.bytes, alloc_stats.peak, alloc_stats.largest, output_ok ? "ok" : "WRONG");
+#ifdef BENCH_STB_IMAGE
+    //the expected output has the parser's channels: RGB for GIF, RGB or RGBA for PNG
+    uint32_t channels = gif || !result.pixels ? 3 : expected.size() / result.pixels;
+    result_s reference;
+    decode_stb(data, gif, channels, reference, true);
+    double stb_ns = measure_ns([&]() { result_s run; decode_stb(data, gif, channels, run, false); }, min_ms);
+    printf(" %9.2f %6s", reference.pixels ? stb_ns / reference.pixels : 0, reference.ok && reference.output == expected ? "same" : "DIFF");
+#endif
+    printf("\n");
+  }
+
+  printf("total: PNG %.2f ns/pixel, GIF %.2f ns/pixel\n\n", total_pixels[0] ? total_ns[0] / total_pixels[0] : 0, total_pixels[1] ? total_ns[1] / total_pixels[1] : 0);
+
+  bench_encoder(min_ms);
+  return result_code;
+}
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+
+#generates the decoder benchmark corpus: PNG (every filter type, RGB/RGBA, compression levels, sizes) and GIF (palette sizes, frame counts)
+#every image is written with its expected decoder output (.raw), the same script always writes the same files
+
+import os
+import struct
+import zlib
+
+dir_corpus = os.path.dirname(os.path.realpath(__file__))+'/corpus'
+
+class random:
+  #small LCG, python's random may change between versions
+  def __init__(self, seed):
+    self.state = seed
+  def next(self):
+    self.state = (self.state * 1103515245 + 12345) & 0x7FFFFFFF
+    return self.state >> 16
+
+def pixels_rgb(width, height, channels, seed):
+  #gradients with some noise, so the filters and the compression levels make a difference
+  rng = random(seed)
+  data = bytearray()
+  for y in range(height):
+    for x in range(width):
+      noise = rng.next() & 0x1F
+      data += bytes([(x * 255 // max(width - 1, 1) + noise) & 0xFF, (y * 255 // max(height - 1, 1)) & 0xFF, ((x ^ y) * 8 + noise) & 0xFF])
+      if channels == 4:
+        data.append((255 - x * 4 + noise) & 0xFF)
+  return data
+
+def paeth(a, b, c):
+  p = a + b - c
+  pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+  if pa <= pb and pa <= pc:
+    return a
+  return b if pb <= pc else c
+
+def filter_row(filter_type, row, prior, bpp):
+  out = bytearray([filter_type])
+  for i in range(len(row)):
+    a = row[i - bpp] if i >= bpp else 0
+    b = prior[i]
+    c = prior[i - bpp] if i >= bpp else 0
+    predictor = [0, a, b, (a + b) // 2, paeth(a, b, c)][filter_type]
+    out.append((row[i] - predictor) & 0xFF)
+  return out
+
+def chunk(chunk_type, data):
+  return struct.pack('>I', len(data)) + chunk_type + data + struct.pack('>I', zlib.crc32(chunk_type + data) & 0xFFFFFFFF)
+
+def write_png(name, width, height, channels, filter_type, level, seed):
+  #filter_type 5: the filters change row by row
+  pixels = pixels_rgb(width, height, channels, seed)
+  stride = width * channels
+  raw = bytearray()
+  prior = bytearray(stride)
+  for y in range(height):
+    row = pixels[y * stride:(y + 1) * stride]
+    raw += filter_row(filter_type if filter_type < 5 else y % 5, row, prior, channels)
+    prior = row
+  ihdr = struct.pack('>IIBBBBB', width, height, 8, 6 if channels == 4 else 2, 0, 0, 0)
+  png = b'\x89PNG\r\n\x1a\n' + chunk(b'IHDR', ihdr) + chunk(b'IDAT', zlib.compress(bytes(raw), level)) + chunk(b'IEND', b'')
+  write(name, png, pixels)
+
+def lzw(indexes, min_code_size):
+  #plain LZW without clear codes in the stream (the parser only accepts the leading one), the table stays full once it's full
+  clear = 1 << min_code_size
+  code_size = min_code_size + 1
+  next_code = clear + 2
+  table = {(i,): i for i in range(clear)}
+  codes = [(clear, code_size)]
+  string = ()
+  for index in indexes:
+    if string + (index,) in table:
+      string += (index,)
+      continue
+    codes.append((table[string], code_size))
+    if next_code < 4096:
+      table[string + (index,)] = next_code
+      next_code += 1
+      if next_code > (1 << code_size) and code_size < 12:
+        code_size += 1
+    string = (index,)
+  codes.append((table[string], code_size))
+  codes.append((clear + 1, code_size))
+
+  out = bytearray()
+  bits = 0
+  bits_size = 0
+  for code, size in codes:
+    bits |= code << bits_size
+    bits_size += size
+    while bits_size >= 8:
+      out.append(bits & 0xFF)
+      bits >>= 8
+      bits_size -= 8
+  if bits_size:
+    out.append(bits & 0xFF)
+  return out
+
+def write_gif(name, size, palette_bits, frames, seed):
+  rng = random(seed)
+  colors = 1 << palette_bits
+  palette = [((i * 97 + 13) & 0xFF, (i * 57 + 101) & 0xFF, (i * 199 + 7) & 0xFF) for i in range(colors)]
+  gif = b'GIF89a' + struct.pack('<HHBBB', size, size, 0x80 | ((palette_bits - 1) << 4) | (palette_bits - 1), 0, 0)
+  gif += b''.join(bytes(color) for color in palette)
+  if frames > 1:
+    gif += b'\x21\xff\x0bNETSCAPE2.0\x03\x01\x00\x00\x00'
+
+  expected = bytearray()
+  min_code_size = max(palette_bits, 2)
+  for frame in range(frames):
+    indexes = [((x + frame) * 3 + y * 5 + (rng.next() & 3)) % colors for y in range(size) for x in range(size)]
+    expected += b''.join(bytes(palette[index]) for index in indexes)
+    if frames > 1:
+      gif += b'\x21\xf9\x04\x00' + struct.pack('<H', 10) + b'\x00\x00'
+    gif += b'\x2c' + struct.pack('<HHHHB', 0, 0, size, size, 0)
+    data = lzw(indexes, min_code_size)
+    gif += bytes([min_code_size])
+    for i in range(0, len(data), 255):
+      gif += bytes([len(data[i:i + 255])]) + data[i:i + 255]
+    gif += b'\x00'
+  gif += b'\x3b'
+  write(name, gif, expected)
+
+def write(name, data, expected):
+  with open(dir_corpus+'/'+name, 'wb') as f:
+    f.write(data)
+  with open(dir_corpus+'/'+name+'.raw', 'wb') as f:
+    f.write(expected)
+
+os.makedirs(dir_corpus, exist_ok=True)
+filters = ['none', 'sub', 'up', 'avg', 'paeth', 'mixed']
+
+#every filter type, RGB and RGBA
+for filter_type in range(len(filters)):
+  for channels in [3, 4]:
+    write_png('png_%s_%s_z6_64x64.png' % (filters[filter_type], 'rgba' if channels == 4 else 'rgb'), 64, 64, channels, filter_type, 6, filter_type)
+
+#compression levels
+for level in [0, 1, 9]:
+  write_png('png_mixed_rgb_z%d_64x64.png' % level, 64, 64, 3, 5, level, 10)
+
+#sizes, the display and bigger ones
+for size in [8, 256]:
+  for channels in [3, 4]:
+    write_png('png_mixed_%s_z6_%dx%d.png' % ('rgba' if channels == 4 else 'rgb', size, size), size, size, channels, 5, 6, 20)
+
+#palette sizes
+for palette_bits in [1, 2, 4, 8]:
+  write_gif('gif_%dcolors_1frame_64x64.gif' % (1 << palette_bits), 64, palette_bits, 1, 30 + palette_bits)
+
+#frame counts
+for frames in [4, 16]:
+  write_gif('gif_16colors_%dframes_64x64.gif' % frames, 64, 4, frames, 40 + frames)
+write_gif('gif_16colors_8frames_8x8.gif', 8, 4, 8, 50)
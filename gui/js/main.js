@@ -1,22 +1,42 @@
-const original_size = 8;
-
-function upload_img(event)
+async function upload_img(event)
 {
   event.preventDefault();
-  const file = document.querySelector('input[type="file"]').files[0];
+  const files = document.querySelector('input[type="file"]').files;
+  if(files.length == 0) return;
 
-  var form_data = new FormData();
-  form_data.append('file', file)
+  //a single file is a raw PUT of its content
+  if(files.length == 1)
+  {
+    const resp = await fetch("image/" + encodeURIComponent(files[0].name), {
+      method: "PUT",
+      headers:{
+        'Content-Type': 'application/octet-stream'
+      },
+      body: await files[0].arrayBuffer()
+    });
+    if(!resp.ok) alert("Upload of " + files[0].name + " failed: " + await resp.text()); //e.g. invalid image or wrong size
+    return;
+  }
 
-  fetch("image", {
-    method: "POST",
-    body: form_data
-  }).then(function(resp)
+  //several files go in one archive: [u8 name length][name][u32 LE size][content] per file
+  const parts = [];
+  for(const file of files)
   {
-    refresh_image();
-    refresh_image_list();
-    refresh_fs_status();
+    const name = new TextEncoder().encode(file.name);
+    const header = new Uint8Array(1 + name.length + 4);
+    header[0] = name.length;
+    header.set(name, 1);
+    new DataView(header.buffer).setUint32(1 + name.length, file.size, true);
+    parts.push(header, await file.arrayBuffer());
+  }
+  const resp = await fetch("images", {
+    method: "PUT",
+    headers:{
+      'Content-Type': 'application/octet-stream'
+    },
+    body: await new Blob(parts).arrayBuffer()
   });
+  if(!resp.ok) alert("Upload failed: " + await resp.text());
 }
 
 function delete_image(name)
@@ -27,17 +47,13 @@ function delete_image(name)
       'Content-Type': 'application/x-www-form-urlencoded'
     },    
     body: new URLSearchParams({'image': name})
-  }).then(function(resp)
-  {
-    refresh_image_list();
-    refresh_image();
-    refresh_fs_status();
   });
 }
 
 function refresh_image_list()
 {
-  fetch("images")
+  //with the metadata, the current estimates are listed too
+  fetch("images?meta=1")
     .then(response => response.json())
     .then(data => {
       let table = document.getElementById("image_list");
@@ -53,12 +69,17 @@ function refresh_image_list()
 
       for (let i = 0; i < data.images.length; i++)
       {
-        let image_name = data.images[i];
+        let image_name = data.images[i].name;
         let tr = document.createElement('tr');
 
         let name = document.createElement('td');
         name.appendChild(document.createTextNode(image_name));
 
+        //at full brightness, 0 until the device has decoded the image
+        let current = document.createElement('td');
+        if(data.images[i].peak_ma > 0) current.appendChild(document.createTextNode(data.images[i].peak_ma + " mA peak, " + data.images[i].avg_ma + " mA average"));
+        else current.appendChild(document.createTextNode("estimating..."));
+
         let sel_d = document.createElement('td');
         let sel_btn = document.createElement('a');
         sel_btn.appendChild(document.createTextNode("select"));
@@ -72,6 +93,7 @@ function refresh_image_list()
         del_d.appendChild(del_btn);
 
         tr.appendChild(name);
+        tr.appendChild(current);
         tr.appendChild(sel_d);
         tr.appendChild(del_d);
 
@@ -82,32 +104,82 @@ function refresh_image_list()
 
 function refresh_image()
 {
+  if(mirror_connected) return; //the canvas shows the LEDs, not the stored file
+
   const ctx = document.getElementById("displayed_image").getContext("2d");
 
-  // Load image
-  const image = new Image();
-  image.onload = () => {
-    // Draw the image into the canvas
-    ctx.drawImage(image, 0, 0);
-  };
-  let ts = new Date().getTime();
-  image.src = "displayed_image?t=" + ts; //force reload image
+  //revalidated with the ETag, the image is only downloaded again if it has changed
+  fetch("displayed_image", {cache: "no-cache"})
+    .then(response => response.blob())
+    .then(blob => {
+      // Load image
+      const image = new Image();
+      image.onload = () => {
+        // Draw the image into the canvas
+        ctx.clearRect(0, 0, ctx.canvas.width, ctx.canvas.height);
+        ctx.drawImage(image, 0, 0);
+        URL.revokeObjectURL(image.src);
+      };
+      image.src = URL.createObjectURL(blob);
+    });
 }
 
-function refresh_fs_status()
+function refresh_current_estimate()
 {
-  fetch("fs_status")
+  fetch("current_estimate")
     .then(response => response.json())
     .then(data => 
     {
-      let total = document.getElementById("total_size");
-      total.innerText = data.total_size + " KBytes";
+      let estimate = document.getElementById("current_estimate");
+      estimate.innerText = "Estimated current: " + data.peak_ma + " mA peak, " + data.avg_ma + " mA average";
+    });
+}
+
+function show_fs_status(data)
+{
+  let total = document.getElementById("total_size");
+  total.innerText = data.total_size + " KBytes";
+
+  let allocated = document.getElementById("allocated_size");
+  allocated.innerText = data.allocated_size + " KBytes";
 
-      let allocated = document.getElementById("allocated_size");
-      allocated.innerText = data.allocated_size + " KBytes";
+  let free_heap = document.getElementById("free_heap");
+  free_heap.innerText = data.free_heap + " Bytes";
+}
+
+function show_settings(data)
+{
+  //don't move a slider while it's being dragged
+  let brightness = document.getElementById("brightness_range");
+  if(document.activeElement != brightness)
+  {
+    brightness.value = data.brightness;
+    document.getElementById("brightness_label").innerText = "Brightness: " + data.brightness + "%";
+  }
+  let max_current = document.getElementById("max_current_range");
+  if(document.activeElement != max_current)
+  {
+    max_current.value = data.max_current;
+    document.getElementById("max_current_label").innerText = "Max current: " + data.max_current + " mA";
+  }
+}
 
-      let free_heap = document.getElementById("free_heap");
-      free_heap.innerText = data.free_heap + " Bytes";
+function load_config()
+{
+  //the page itself is static, the device's values are loaded once, later changes are pushed as events
+  fetch("gui_config")
+    .then(response => response.json())
+    .then(data =>
+    {
+      const canvas = document.getElementById("displayed_image");
+      if(canvas.width != data.width || canvas.height != data.height)
+      {
+        canvas.width = data.width;
+        canvas.height = data.height;
+        refresh_image();
+      }
+      show_settings(data);
+      show_fs_status(data);
     });
 }
 
@@ -119,9 +191,6 @@ function set_displayed_image(name)
       'Content-Type': 'application/x-www-form-urlencoded'
     },    
     body: new URLSearchParams({'displayed_image': name})
-  }).then(function(resp)
-  {
-    refresh_image();
   });
 }
 
@@ -151,11 +220,61 @@ function max_current_changed()
   });
 }
 
+let mirror_connected = false;
+
+function connect_mirror()
+{
+  //the device pushes the displayed frames: a full frame first, then only the changed pixels
+  const canvas = document.getElementById("displayed_image");
+  const ctx = canvas.getContext("2d");
+  let frame = null;
+
+  const socket = new WebSocket("ws://" + location.host + "/framebuffer");
+  socket.binaryType = "arraybuffer";
+  socket.onopen = () => mirror_connected = true;
+  socket.onclose = () => {
+    mirror_connected = false;
+    refresh_image();
+    setTimeout(connect_mirror, 5000);
+  };
+  socket.onmessage = (e) => {
+    const data = new Uint8Array(e.data);
+    if(data[0] == 0) //full frame: type, width, height, RGB pixels
+    {
+      const width = data[1] | (data[2] << 8);
+      const height = data[3] | (data[4] << 8);
+      frame = ctx.createImageData(width, height);
+      for(let i = 0; i < width * height; i++)
+      {
+        frame.data.set(data.subarray(5 + 3 * i, 8 + 3 * i), 4 * i);
+        frame.data[4 * i + 3] = 255;
+      }
+    }
+    else if(data[0] == 1 && frame) //delta: type, (index, R, G, B) of the changed pixels
+    {
+      for(let i = 1; i + 5 <= data.length; i += 5)
+      {
+        const index = data[i] | (data[i + 1] << 8);
+        frame.data.set(data.subarray(i + 2, i + 5), 4 * index);
+      }
+    }
+    if(frame) ctx.putImageData(frame, 0, 0);
+  };
+}
+
 document.getElementById("upload_form").onsubmit = upload_img;
-refresh_image();
-refresh_image_list();
-setInterval(() => {
-  refresh_fs_status();
+load_config();
+connect_mirror();
+
+//the device pushes every change, nothing is polled (the whole state is pushed on (re)connect)
+const events = new EventSource("events");
+events.addEventListener("displayed", () => {
   refresh_image();
-  refresh_image_list();
-}, 10000);
\ No newline at end of file
+  refresh_current_estimate();
+});
+events.addEventListener("catalog", () => refresh_image_list());
+events.addEventListener("settings", (e) => {
+  show_settings(JSON.parse(e.data));
+  refresh_current_estimate();
+});
+events.addEventListener("storage", (e) => show_fs_status(JSON.parse(e.data)));
\ No newline at end of file
@@ -1,43 +1,60 @@
 #!/usr/bin/env python3
 
 import os
-import shutil
 import gzip
+import hashlib
 
 dir_js = 'js'
 dir_css = 'css'
 dir_html = 'html'
-dir_output = 'output'
-dir_data = os.path.dirname(os.path.realpath(__file__))+'/../data'
-
-def copy(source, target):
-  files = os.listdir(source)
-  for file_name in files:
-    shutil.copy(source+'/'+file_name, target+'/'+file_name)
-
-#create output directory
-if os.path.exists(dir_output)==True:
-  shutil.rmtree(dir_output)
-os.mkdir(dir_output)
-
-#copy css content & js content
-copy(dir_css, dir_output)
-copy(dir_js, dir_output)
-
-#compress files
-output_files = os.listdir(dir_output)
-for file_name in output_files:
-  with open(dir_output+'/'+file_name, 'rb') as f_in:
-    with gzip.open(dir_output+'/'+file_name+'.gz', 'wb') as f_out:
-      shutil.copyfileobj(f_in, f_out)
-  os.remove(dir_output+'/'+file_name)
-
-#copy html
-copy(dir_html, dir_output)  
-
-#copy output to data
-if os.path.exists(dir_data)==True:
-  shutil.rmtree(dir_data)
-os.mkdir(dir_data)
-
-copy(dir_output, dir_data)
+dir_gui = os.path.dirname(os.path.realpath(__file__))
+file_header = dir_gui+'/../include/gui_data.hpp'
+hash_bytes = 8 #same as CONTENT_HASH_BYTES
+
+def read(path):
+  with open(dir_gui+'/'+path, 'rb') as f:
+    return f.read()
+
+def compress(data):
+  #no timestamp in the gzip header, the same sources give the same header
+  return gzip.compress(data, 9, mtime=0)
+
+def content_hash(data):
+  return hashlib.sha1(data).hexdigest()[:hash_bytes*2]
+
+def c_name(file_name):
+  return file_name.replace('.', '_').replace('-', '_')
+
+def c_array(name, data):
+  lines = ['    const uint8_t '+name+'[] PROGMEM = {']
+  for i in range(0, len(data), 16):
+    lines.append('     '+''.join(' 0x%02X,' % b for b in data[i:i+16]))
+  lines.append('    };')
+  return '\n'.join(lines)
+
+#gzip css & js content
+files = {}
+for directory in [dir_css, dir_js]:
+  for file_name in sorted(os.listdir(dir_gui+'/'+directory)):
+    files[file_name] = compress(read(directory+'/'+file_name))
+
+#index.html refers to the assets with their hash in the URL, substituted here instead of a template processor on every page load
+for file_name in sorted(os.listdir(dir_gui+'/'+dir_html)):
+  html = read(dir_html+'/'+file_name).decode('utf-8')
+  for asset_name, data in files.items():
+    html = html.replace('%'+c_name(asset_name).upper()+'_HASH%', content_hash(data))
+  files[file_name] = compress(html.encode('utf-8'))
+
+#generated header with the gzipped files, their sizes and hashes
+output = ['//generated by gui/pack.py from the gui folder, don\'t edit', '#pragma once', '', '#include <Arduino.h>', '', 'namespace pixelbox', '{', '  namespace gui_data', '  {']
+for file_name, data in files.items():
+  name = c_name(file_name)
+  output.append('    //'+file_name+' gzipped')
+  output.append(c_array(name+'_gz', data))
+  output.append('    const uint32_t '+name+'_gz_size = '+str(len(data))+';')
+  output.append('    const char '+name+'_hash[] = "'+content_hash(data)+'";')
+  output.append('')
+output[-1:] = ['  }', '}', '']
+
+with open(file_header, 'w') as f:
+  f.write('\n'.join(output))
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cinttypes>
+
+namespace pixelbox
+{
+  namespace alloc
+  {
+    //every heap call of the parsers and the animation store goes through here, so the cost of a decode can be measured
+    //portable (no Arduino header), the parsers are built on the host as well
+
+    typedef struct allocator_s
+    {
+      void* (*malloc)(size_t size);
+      void* (*calloc)(size_t count, size_t size);
+      void* (*realloc)(void* ptr, size_t size);
+      void (*free)(void* ptr);
+      size_t (*size)(void* ptr); //usable size of an allocated block, NULL if unknown (live bytes are measured on the heap then, device only)
+    } allocator_s;
+
+    typedef struct stats_s
+    {
+      uint32_t calls;       //allocations (malloc, calloc, realloc)
+      uint32_t bytes;       //requested bytes altogether
+      uint32_t live;        //bytes allocated and not freed yet
+      uint32_t peak;        //highest live bytes
+      uint32_t largest;     //largest single request
+      uint32_t free_block;  //largest free heap block when the measurement started (device only, 0 on the host)
+    } stats_s;
+
+    void set_allocator(const allocator_s* allocator); //NULL: the system allocator, only switch while nothing allocated by the previous one is alive
+
+    void* malloc(size_t size);
+    void* calloc(size_t count, size_t size);
+    void* realloc(void* ptr, size_t size);
+    void free(void* ptr);
+
+    //a measurement, e.g. one decode: begin() clears the counters, end() keeps them as the last stats
+    //a measurement started meanwhile takes over, the interrupted one is dropped at its end()
+    uint32_t begin();
+    void end(uint32_t measurement);
+    stats_s current();  //counters of the running measurement
+    stats_s last();     //counters of the last finished measurement
+  }
+}
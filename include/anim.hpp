@@ -2,6 +2,8 @@
 
 #include <FastLED.h>
 
+#include "led_current.hpp"
+
 #define FRAME_ALLOCATION_SIZE 4
 
 namespace pixelbox
@@ -15,6 +17,8 @@ namespace pixelbox
       uint32_t y;            //starting Y coord of the frame (based on GIF partial refresh)
       CRGB* pixels;          //pixel array pointer
       uint32_t pixels_size;  //pixel array size
+      uint32_t current_ma;   //estimated current draw of the frame at full brightness
+      bool mapped;           //pixels point into memory mapped flash: not owned, read with memcpy_P only
     }frame_s;
 
     typedef struct animation_s   //animation consisting multiple frames
@@ -26,6 +30,9 @@ namespace pixelbox
     }animation_s;
     
     bool add_frame(animation_s* anim, uint32_t delay_ms, uint32_t x, uint32_t y, CRGB* pixels, uint32_t pixels_size); //add a frame to an animation and copy associated data (dynamic mem allocation, using calloc/realloc)
+    bool add_mapped_frame(animation_s* anim, uint32_t delay_ms, const CRGB* pixels, uint32_t pixels_size, uint32_t current_ma); //add a full frame read right from mapped flash, no pixel copy
     bool animation_init(animation_s* anim); //init animation struct, reset if it contains data (dynamic mem deallocation, using free)
+    uint32_t estimate_current(const CRGB* pixels, uint32_t pixels_size); //estimated current draw (mA) of pixel data at full brightness
+    void estimate_current(const animation_s* anim, uint32_t& peak_ma, uint32_t& avg_ma, uint32_t (*predict)(uint32_t current_ma) = NULL); //peak and frame delay weighted average of the frames' estimates, each passed through predict (e.g. the brightness limit) if given
   } 
 }
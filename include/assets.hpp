@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "anim.hpp"
+#include "assets_format.hpp"
+
+namespace pixelbox
+{
+  namespace assets
+  {
+    //read-only region of pre-decoded frames, displayed right from memory mapped flash (no file read, no decode, no pixel copy on the heap)
+    //on the ESP8266 the region is linked into the flash (PROGMEM) and only read with 32 bit aligned loads (memcpy_P)
+    //on the host the same code reads a memory mapped region file
+
+    typedef struct region_s
+    {
+      const uint8_t* base;    //NULL if nothing is mapped
+      uint32_t size;
+      uint32_t count;
+      int fd;                 //host only, the mapped region file
+    } region_s;
+
+    bool map(region_s& region, const uint8_t* base); //use a region already in the address space, false if it's invalid
+#ifndef ARDUINO
+    bool map_file(region_s& region, const char* path); //mmap a region file
+    void unmap(region_s& region);
+#endif
+
+    const region_s& builtin(); //the region linked into the firmware
+
+    bool get(const region_s& region, uint32_t index, asset_s& asset); //asset header copied out of the region
+    int32_t find(const region_s& region, const char* name); //index of the asset, -1 if not found
+    const uint8_t* frame_pixels(const region_s& region, const asset_s& asset, uint32_t frame, frame_header_s& header); //pointer into the region, NULL if out of range
+
+    //animation with the frames pointing into the region, only the frame table is allocated
+    bool load(const region_s& region, uint32_t index, anim::animation_s* anim);
+  }
+}
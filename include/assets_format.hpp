@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+//layout of an asset region, no Arduino dependency: shared by the firmware (assets.hpp) and the host tool generating the region (tools/assets)
+//little endian like the ESP8266, every struct is 4 byte aligned
+
+#define ASSETS_MAGIC     0x53415850  //"PXAS", start of a region
+#define ASSETS_NAME_MAX  24          //including the terminating zero
+
+namespace pixelbox
+{
+  namespace assets
+  {
+    typedef struct header_s   //start of a region, followed by count asset_s
+    {
+      uint32_t magic;
+      uint32_t count;         //assets in the region
+      uint32_t size;          //region size in bytes
+    } header_s;
+
+    typedef struct asset_s    //one image or animation
+    {
+      char name[ASSETS_NAME_MAX];
+      uint16_t width;
+      uint16_t height;
+      uint32_t frames;
+      uint32_t offset;        //first frame_header_s from the start of the region, the frames follow each other
+    } asset_s;
+
+    typedef struct frame_header_s  //followed by width * height RGB pixels, padded to 4 bytes
+    {
+      uint32_t delay_ms;
+      uint32_t current_ma;    //estimated current draw at full brightness
+    } frame_header_s;
+
+    inline uint32_t frame_stride(uint16_t width, uint16_t height) //bytes of a frame, header included
+    {
+      return sizeof(frame_header_s) + ((width * height * 3 + 3) & ~3);
+    }
+  }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "content_hash.hpp"
+
+#define CATALOG_DIR             "/images"  //images stored as plain files, moved into the store on boot
+#define CATALOG_NAME_MAX        32   //LittleFS file name limit, including the terminating zero
+#define CATALOG_ALLOCATION_SIZE 8    //entries allocated at once
+
+namespace pixelbox
+{
+  namespace catalog
+  {
+    typedef enum format_e
+    {
+      format_unknown = 0,
+      format_png = 1,
+      format_gif = 2,
+    } format_e;
+
+    typedef struct entry_s     //one stored image
+    {
+      char name[CATALOG_NAME_MAX];
+      uint32_t size;           //file size in bytes
+      uint32_t stamp;          //changes on every write of the file, identifies the content for caches
+      uint16_t width;          //image size based on the header, 0 if unknown
+      uint16_t height;
+      uint16_t frames;         //frame count (1 for PNG)
+      uint16_t peak_ma;        //current estimates at full brightness, 0 until the image is decoded once (upload, display or the background estimate)
+      uint16_t avg_ma;
+      uint8_t format;          //format_e
+      char hash[CONTENT_HASH_HEX_SIZE]; //content hash, also the key of the content in the store
+    } entry_s;
+
+    //sorted in-memory list of the stored images, built once on boot and updated on every change
+    void setup();
+    uint32_t count();
+    uint32_t version();                       //changes whenever an image is added, changed or removed
+    uint32_t estimates_version();             //changes whenever a current estimate is set
+    const entry_s* at(uint32_t index);
+    int32_t find(const String& name);         //index of the entry, -1 if not found (O(1) for the last found entry)
+    const entry_s* next(const String& name);  //entry after name, wrapping around (first entry if name is not found)
+    const entry_s* previous(const String& name);
+    bool update(const String& name);          //(re)read the file's header and insert or refresh its entry
+    uint32_t update_all(const String& names); //update() of many images (one name per line) with a single version change, returns the updated count
+    bool remove(const String& name);
+    void set_current_estimate(const String& name, uint32_t peak_ma, uint32_t avg_ma);
+    const char* hash(const String& name);     //content hash of the image, NULL if not found
+
+    format_e format_of(const String& name);  //based on the file extension
+    const char* format_name(uint8_t format);
+  }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+#include <bearssl/bearssl_hash.h>
+
+#define CONTENT_HASH_BYTES     8    //leading bytes of the SHA-1 used, plenty for telling versions of a file apart
+#define CONTENT_HASH_HEX_SIZE  (CONTENT_HASH_BYTES * 2 + 1)
+#define CONTENT_HASH_READ_SIZE 256  //stack buffer for hashing files
+
+namespace pixelbox
+{
+  namespace content_hash
+  {
+    //incremental SHA-1 (BearSSL, part of the core), the result is a hex string used as ETag and cache buster
+    typedef br_sha1_context hasher_s;
+
+    void begin(hasher_s& hasher);
+    void update(hasher_s& hasher, const uint8_t* data, uint32_t len);
+    void finish(const hasher_s& hasher, char hex[CONTENT_HASH_HEX_SIZE]);
+
+    bool file(const String& path, char hex[CONTENT_HASH_HEX_SIZE]); //hash of a stored file, false if it can't be read
+  }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cinttypes>
+
+//Distributed Display Protocol (DDP, http://www.3waylabs.com/ddp/) packet handling, pure C++ (no Arduino dependency)
+//only pixel data for the default output device is handled (sent by xLights, WLED, LedFx, ...)
+
+#define DDP_PORT            4048
+#define DDP_HEADER_SIZE     10    //without timecode
+#define DDP_FLAG_VERSION_1  0x40
+#define DDP_FLAG_VERSION    0xC0
+#define DDP_FLAG_TIMECODE   0x10
+#define DDP_FLAG_QUERY      0x02
+#define DDP_FLAG_PUSH       0x01
+#define DDP_ID_DISPLAY      1     //default output device
+
+namespace pixelbox
+{
+  namespace ddp
+  {
+    typedef struct header_s
+    {
+      uint8_t flags;
+      uint8_t sequence;     //1..15, 0 if not used
+      uint8_t data_type;
+      uint8_t id;           //destination
+      uint32_t offset;      //byte offset of the data in the frame
+      uint16_t length;      //data bytes
+      const uint8_t* data;
+    } header_s;
+
+    typedef struct stats_s  //counters and sequence state of one receiver
+    {
+      uint32_t packets;
+      uint32_t frames;      //pushed frames
+      uint32_t invalid;     //malformed or not for us
+      uint32_t lost;        //sequence number gaps
+      uint8_t last_sequence; //of the last accepted packet, 0 if the sender doesn't use them
+    } stats_s;
+
+    bool parse(const uint8_t* packet, uint32_t len, header_s& header); //false if not a valid DDP v1 packet
+
+    //copy a packet's pixel data into the frame (frame_size bytes, RGB), returns true if the frame is complete (push)
+    bool receive(const uint8_t* packet, uint32_t len, uint8_t* frame, uint32_t frame_size, stats_s& stats);
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "anim.hpp"
+#include "catalog.hpp"
+#include "gif_parse.hpp"
+#include "png_parse.hpp"
+#include "store.hpp"
+
+#define DECODER_READ_SLICE            1024   //bytes read from flash in one step of a decoding job
+#define DECODER_STREAM_MAX_SIZE       32768  //bigger uploads are not decoded while received, only from flash afterwards
+#define DECODER_STREAM_MIN_FREE_HEAP  16384  //free heap left after reserving the input buffer of a stream
+
+namespace pixelbox
+{
+  namespace decoder
+  {
+    //decode a PNG/GIF file image into an animation (still images are one frame animations with zero delay)
+    //anim must be initialized, returns false on parse error or if the image size doesn't match the display
+    //if release_data is set, data (malloc'd) is freed as soon as the parser copied it, lowering the peak heap usage
+    bool decode(uint8_t* data, uint32_t size, catalog::format_e format, anim::animation_s* anim, bool release_data = false);
+
+    //read a stored image from flash and decode it
+    bool decode_file(const String& name, anim::animation_s* anim);
+
+    typedef enum job_state_e
+    {
+      job_state_idle = 0,
+      job_state_reading = 1,  //reading the file into the parser's buffer
+      job_state_parsing = 2,  //parsing chunk by chunk (PNG) or block by block (GIF)
+      job_state_done = 3,     //anim holds the decoded image
+      job_state_failed = 4,
+    } job_state_e;
+
+    typedef struct job_s    //decoding a stored image in small steps, so it can run in the background
+    {
+      job_state_e state;
+      String name;
+      uint32_t stamp;         //catalog stamp of the file when the job was started
+      catalog::format_e format;
+      store::reader_s file;
+      uint32_t size;          //file size
+      uint32_t read;          //bytes already read
+      uint32_t measurement;   //heap accounting of the decode (alloc::begin)
+      img_parse::png_parse_context_s png;
+      img_parse::gif_parse_context_s gif;
+      anim::animation_s anim; //result
+    } job_s;
+
+    bool job_start(job_s& job, const String& name, uint32_t stamp);
+    bool job_step(job_s& job);   //do one step (read a slice or parse a chunk/block), returns true while there is work left
+    void job_cancel(job_s& job); //stop and free everything, including the result
+
+    typedef struct stream_s    //decoding an image while it's being received, chunk by chunk (PNG) or block by block (GIF)
+    {
+      catalog::format_e format;
+      bool active;             //data is parsed as it arrives, false if the image is too big or turned out to be invalid
+      bool begun;              //header received and checked
+      bool done;               //anim holds the decoded image
+      bool header_only;        //only the header and the display size are checked, nothing is decoded
+      uint32_t measurement;    //heap accounting of the decode (alloc::begin)
+      img_parse::png_parse_context_s png;
+      img_parse::gif_parse_context_s gif;
+      anim::animation_s anim;
+    } stream_s;
+
+    bool stream_begin(stream_s& stream, catalog::format_e format, uint32_t expected_size, bool header_only = false); //false if the stream is not active
+    bool stream_feed(stream_s& stream, const uint8_t* data, uint32_t len); //false if the image is invalid (bad header, size or data)
+    void stream_cancel(stream_s& stream); //stop and free everything, including the result
+
+    //heap used by a decoded animation (the heap used while decoding: alloc::last())
+    uint32_t animation_bytes(const anim::animation_s* anim);
+  }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <ESPAsyncWebServer.h>
+
+#define EVENTS_INTERVAL_MS   250   //changes are collected and pushed at most this often
+#define EVENTS_RECONNECT_MS  5000  //browser reconnect delay after a lost connection
+
+namespace pixelbox
+{
+  namespace events
+  {
+    //Server-Sent Events on /events, the GUI is updated by pushes instead of polling
+    //events (data is JSON): "displayed" {name} (also when the displayed image's content changed), "catalog" {count} (also when a current estimate changed), "settings" {brightness, max_current}, "storage" {total_size, allocated_size, free_heap}
+
+    void setup(AsyncWebServer& server);
+    void loop(); //compares the state with the last pushed one, sends only the changes and only if a client is connected
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include "content_hash.hpp"
+
+#define FILE_WRITER_BLOCK_SIZE 4096    //LittleFS block size, writes are coalesced into whole blocks
+#define FILE_WRITER_TEMP_DIR   "/tmp"  //files being written, renamed to their final path when complete
+
+namespace pixelbox
+{
+  namespace file_writer
+  {
+    typedef struct writer_s    //one file being written
+    {
+      File file;
+      String path;             //final path, can be set up until commit()
+      String temp_path;
+      uint8_t* buffer;         //FILE_WRITER_BLOCK_SIZE bytes, flushed at block aligned file offsets
+      uint32_t buffered;
+      uint32_t flushed;        //bytes in the temp file
+      uint32_t size;           //bytes written so far (including the buffered ones)
+      uint32_t start_ms;
+      uint32_t flash_us;       //time spent in flash writes
+      bool failed;
+      content_hash::hasher_s hasher; //content hash computed on the fly, no need to read the file again
+    } writer_s;
+
+    typedef struct stats_s     //throughput of a committed file
+    {
+      uint32_t size;
+      uint32_t total_ms;       //from begin() to commit(), including the network transfer
+      uint32_t flash_ms;       //time spent writing the flash
+      char hash[CONTENT_HASH_HEX_SIZE];
+    } stats_s;
+
+    //writes go to a temp file and a block sized buffer, the final file is replaced only by commit()
+    //expected_size (0 if unknown) is checked against the free space before anything is written
+    bool begin(writer_s& writer, const String& path, uint32_t expected_size);
+    bool write(writer_s& writer, const uint8_t* data, uint32_t len);
+    bool finish(writer_s& writer, stats_s* stats = NULL); //flush and close, the temp file is then moved by commit() or dropped by discard()
+    bool commit(writer_s& writer, stats_s* stats = NULL); //finish (if not done yet) and atomically rename over writer.path, the buffer is kept for the next begin()
+    void discard(writer_s& writer);                       //drop the temp file but keep the buffer for the next begin()
+    void abort(writer_s& writer);                         //drop the temp file (the final path is untouched) and free the buffer
+    bool active(const writer_s& writer);
+
+    void setup(); //remove temp files left by uploads interrupted by a reset
+  }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace pixelbox
+{
+  namespace fs_usage
+  {
+    //filesystem usage kept in RAM: LittleFS.info() walks the block allocation, it's called only once on boot
+    //every write and remove of our code reports the size change, the usage is counted in whole blocks like LittleFS does
+
+    void setup(); //after every boot time filesystem change (settings migration, store setup)
+
+    uint32_t total();       //filesystem size in bytes
+    uint32_t used();        //allocated bytes
+    uint32_t free_space();  //bytes left
+    uint32_t block_size();
+
+    void resized(uint32_t old_size, uint32_t new_size); //a file changed its size, 0 for a created or removed one
+  }
+}
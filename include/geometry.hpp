@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cinttypes>
+
+namespace pixelbox
+{
+  namespace geometry
+  {
+    typedef enum wiring_e
+    {
+      wiring_progressive = 0, //every row of a panel starts on the same side
+      wiring_serpentine = 1,  //every second row of a panel runs backwards
+    } wiring_e;
+
+    typedef enum rotation_e   //clockwise rotation of the image on the physical matrix
+    {
+      rotation_0 = 0,
+      rotation_90 = 1,
+      rotation_180 = 2,
+      rotation_270 = 3,
+    } rotation_e;
+
+    //LED matrix built from TILES_X * TILES_Y identical panels of PANEL_WIDTH * PANEL_HEIGHT LEDs
+    //panels are chained row by row (left to right, top to bottom), every panel is wired the same way
+    //everything is constexpr, the logical (image) -> LED index mapping is a table built by the compiler
+    template<uint16_t PANEL_WIDTH, uint16_t PANEL_HEIGHT, uint8_t TILES_X, uint8_t TILES_Y, wiring_e WIRING, rotation_e ROTATION>
+    struct layout_t
+    {
+      //physical size of the whole matrix
+      static constexpr uint16_t physical_width = PANEL_WIDTH * TILES_X;
+      static constexpr uint16_t physical_height = PANEL_HEIGHT * TILES_Y;
+
+      //logical (image) size, width and height are swapped if rotated by 90 or 270 degrees
+      static constexpr bool swapped = ROTATION == rotation_90 || ROTATION == rotation_270;
+      static constexpr uint16_t width = swapped ? physical_height : physical_width;
+      static constexpr uint16_t height = swapped ? physical_width : physical_height;
+      static constexpr uint32_t num = (uint32_t)width * height;
+      static_assert(num > 0 && num <= 0x10000, "LED count must fit the 16 bit lookup table");
+
+      //true if logical pixel order equals the LED order, the framebuffer can be simply copied then
+      static constexpr bool identity = ROTATION == rotation_0 && TILES_X == 1 && TILES_Y == 1 && (WIRING == wiring_progressive || PANEL_HEIGHT == 1);
+
+      //LED index inside one panel
+      static constexpr uint32_t panel_index(uint16_t x, uint16_t y)
+      {
+        return (uint32_t)y * PANEL_WIDTH + ((WIRING == wiring_serpentine && (y & 0x01)) ? (PANEL_WIDTH - 1 - x) : x);
+      }
+
+      //LED index of a physical coordinate
+      static constexpr uint32_t led_index(uint16_t px, uint16_t py)
+      {
+        return ((uint32_t)(py / PANEL_HEIGHT) * TILES_X + px / PANEL_WIDTH) * PANEL_WIDTH * PANEL_HEIGHT + panel_index(px % PANEL_WIDTH, py % PANEL_HEIGHT);
+      }
+
+      //LED index of a logical (image) coordinate
+      static constexpr uint32_t xy(uint16_t x, uint16_t y)
+      {
+        return ROTATION == rotation_0   ? led_index(x, y) :
+               ROTATION == rotation_90  ? led_index(physical_width - 1 - y, x) :
+               ROTATION == rotation_180 ? led_index(physical_width - 1 - x, physical_height - 1 - y) :
+                                          led_index(y, physical_height - 1 - x);
+      }
+
+      //lookup table of xy() for every logical pixel index, evaluated at compile time
+      typedef struct map_s
+      {
+        uint16_t index[num];
+        constexpr map_s() : index()
+        {
+          for(uint32_t i = 0; i < num; i++) index[i] = xy(i % width, i / width);
+        }
+      } map_s;
+
+      static constexpr map_s map = map_s();
+    };
+  }
+}
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <cstring>
 #include <cinttypes>
 #include <cstdlib>
@@ -147,6 +149,7 @@ namespace img_parse
     uint8_t* input;
     uint32_t input_size;
     uint32_t offset;
+    uint32_t input_allocated; //allocated size of input when streaming, input_size is the received part
 
     logical_screen_descriptor_s lsd;
 
@@ -164,6 +167,17 @@ namespace img_parse
   } gif_parse_context_s;
 
   error_code_e init(gif_parse_context_s& ctx, uint8_t* input, uint32_t input_size);
+  error_code_e init_buffer(gif_parse_context_s& ctx, uint32_t input_size); //allocate ctx.input only, the caller fills it (e.g. right from flash)
+  error_code_e init_stream(gif_parse_context_s& ctx, uint32_t reserve); //empty input, data arrives later through append()
   error_code_e parse(gif_parse_context_s& ctx);
   void deinit(gif_parse_context_s& ctx);  
+
+  //parsing in small steps, for time slicing: parse_begin() once, then parse_step() until ctx.parsed
+  error_code_e parse_begin(gif_parse_context_s& ctx); //header, logical screen descriptor, global color table
+  error_code_e parse_step(gif_parse_context_s& ctx);  //parse the next block
+
+  //streaming: append() the data as it arrives, call parse_begin()/parse_step() only when the data for it is complete
+  error_code_e append(gif_parse_context_s& ctx, const uint8_t* data, uint32_t len);
+  bool begin_complete(const gif_parse_context_s& ctx); //header, logical screen descriptor and global color table received
+  bool step_complete(const gif_parse_context_s& ctx);  //next block received entirely
 }
@@ -0,0 +1,382 @@
+//generated by gui/pack.py from the gui folder, don't edit
+#pragma once
+
+#include <Arduino.h>
+
+namespace pixelbox
+{
+  namespace gui_data
+  {
+    //mvp.css gzipped
+    const uint8_t mvp_css_gz[] PROGMEM = {
+      0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x59, 0x6D, 0x6F, 0xE3, 0xC6,
+      0x11, 0xFE, 0xAE, 0x5F, 0xB1, 0x50, 0x10, 0xC0, 0xBA, 0x88, 0x32, 0x25, 0x5B, 0x67, 0x1F, 0x83,
+      0x00, 0x45, 0x5B, 0x04, 0x09, 0x90, 0xA4, 0x69, 0xAE, 0xE9, 0x97, 0x83, 0x3F, 0x2C, 0xC9, 0x25,
+      0xB5, 0xF5, 0x92, 0xCB, 0x92, 0x4B, 0x59, 0x4A, 0x91, 0xFF, 0xDE, 0xD9, 0x37, 0x72, 0xF9, 0x26,
+      0xD1, 0x77, 0x69, 0x71, 0x36, 0x64, 0x93, 0x3B, 0xCB, 0xE1, 0xBC, 0x3E, 0x33, 0xB3, 0xBA, 0x7D,
+      0x83, 0x7E, 0xFC, 0xE7, 0xCF, 0x9B, 0xA8, 0xAA, 0xD0, 0x71, 0xBB, 0xD9, 0x6E, 0x91, 0x87, 0x0E,
+      0x42, 0x14, 0x55, 0x70, 0x7B, 0x9B, 0x52, 0x71, 0xA8, 0xC3, 0x4D, 0xC4, 0xB3, 0x5B, 0x9C, 0xC7,
+      0xE7, 0xB0, 0x24, 0x2F, 0xA4, 0xBC, 0xCD, 0x8E, 0x05, 0x7A, 0x73, 0xBB, 0x58, 0x04, 0x25, 0xE7,
+      0x02, 0xFD, 0x67, 0x81, 0xE0, 0xC7, 0xF3, 0x70, 0x24, 0xE8, 0x91, 0x78, 0x61, 0x49, 0xD3, 0x83,
+      0xC8, 0x49, 0x55, 0x05, 0xC8, 0xDF, 0x3C, 0xEE, 0xBF, 0x36, 0xE4, 0x90, 0x97, 0x31, 0x29, 0xBD,
+      0x12, 0xC7, 0xB4, 0x06, 0xD2, 0xBE, 0x38, 0xB5, 0x94, 0x93, 0x57, 0x1D, 0x70, 0xCC, 0x5F, 0x02,
+      0xB4, 0x2B, 0x4E, 0xEA, 0xB3, 0xF5, 0x5B, 0x7A, 0xC4, 0x19, 0x2F, 0x81, 0x7D, 0x44, 0x72, 0x11,
+      0xA0, 0x2F, 0xB6, 0xDB, 0xC7, 0x90, 0x90, 0xED, 0xBE, 0x4B, 0x0E, 0x53, 0x20, 0x25, 0x49, 0xD2,
+      0x5F, 0xF5, 0x2A, 0x12, 0xF1, 0x3C, 0xC6, 0xE5, 0x19, 0xE8, 0xE4, 0x9D, 0xFC, 0xED, 0x6E, 0x61,
+      0x34, 0x7F, 0x6E, 0xB8, 0x76, 0x49, 0xEE, 0xA3, 0xEF, 0x76, 0x7E, 0xDC, 0x7F, 0xB4, 0xA1, 0xB7,
+      0xC2, 0xE9, 0x6D, 0x7E, 0xD8, 0xDB, 0x68, 0xB4, 0xFB, 0x22, 0xB9, 0x97, 0xBF, 0x5D, 0xA2, 0xC0,
+      0x21, 0x23, 0x13, 0x12, 0x08, 0x72, 0x92, 0x5C, 0x7D, 0xDF, 0x1F, 0xAE, 0x77, 0xC5, 0x7B, 0xD7,
+      0xC8, 0x96, 0xF0, 0x5C, 0x78, 0x09, 0xCE, 0x28, 0x03, 0x82, 0x87, 0x8B, 0x82, 0x11, 0xAF, 0x3A,
+      0x57, 0x82, 0x64, 0x6B, 0xF4, 0x67, 0xA9, 0xED, 0x8F, 0x38, 0x7A, 0xAF, 0xEE, 0xBF, 0x85, 0x9D,
+      0x6B, 0xB4, 0x7C, 0x4F, 0x52, 0x4E, 0xD0, 0xAF, 0xDF, 0x2F, 0xD7, 0xE8, 0x17, 0x1E, 0x72, 0xC1,
+      0xD7, 0xE8, 0x6F, 0xA7, 0x73, 0x4A, 0x72, 0xEF, 0x3D, 0xCE, 0xAB, 0x35, 0xFA, 0x35, 0xAC, 0x73,
+      0x51, 0xAF, 0xD1, 0x5F, 0x70, 0x2E, 0x70, 0x49, 0x18, 0x83, 0x67, 0xBE, 0x23, 0xEC, 0x48, 0x04,
+      0x8D, 0x30, 0xFA, 0x89, 0xD4, 0x04, 0x9E, 0xAC, 0x60, 0x2B, 0x48, 0x54, 0xD2, 0xC6, 0x03, 0x07,
+      0x7E, 0x04, 0x7F, 0xBB, 0xE1, 0xB0, 0xDD, 0xEC, 0x2C, 0xF1, 0x5F, 0x75, 0x25, 0x68, 0x72, 0xF6,
+      0x68, 0x56, 0xF0, 0x52, 0x60, 0x69, 0x3B, 0x69, 0x41, 0x52, 0xF6, 0x37, 0xE4, 0xBC, 0xCC, 0x30,
+      0x0B, 0x10, 0x23, 0x89, 0xB0, 0x34, 0x50, 0x82, 0x78, 0x07, 0x22, 0x19, 0x4B, 0xA6, 0x4D, 0x24,
+      0xBC, 0xD0, 0x58, 0x1C, 0xBC, 0x08, 0x97, 0x31, 0x04, 0xD2, 0xA3, 0x13, 0x61, 0x2D, 0xC1, 0xCB,
+      0x08, 0xC4, 0x5F, 0x16, 0xA0, 0xFB, 0xB7, 0xFE, 0x28, 0x1D, 0x2E, 0xC1, 0x19, 0x8F, 0xFE, 0x90,
+      0x0A, 0xC6, 0x52, 0x3E, 0xDE, 0xFA, 0x8F, 0x8A, 0xF8, 0xFB, 0x62, 0xF1, 0x27, 0xC9, 0x0D, 0xA3,
+      0x9B, 0xA2, 0x24, 0x09, 0x29, 0x2B, 0xEB, 0xED, 0xE8, 0x40, 0x32, 0x60, 0x02, 0xAE, 0x79, 0x5E,
+      0x99, 0xF4, 0x50, 0xA9, 0xF2, 0x41, 0xD3, 0x33, 0x1E, 0x93, 0x6F, 0x96, 0x35, 0x18, 0x6B, 0xF9,
+      0x64, 0xC8, 0xA3, 0x81, 0xEE, 0xFB, 0xEF, 0x1E, 0x92, 0xE8, 0xDE, 0x18, 0x74, 0x10, 0xEC, 0x77,
+      0x77, 0x77, 0x63, 0x94, 0x4E, 0x58, 0xEC, 0xF7, 0xFB, 0xE1, 0x1E, 0x13, 0xF1, 0x9A, 0xFD, 0x90,
+      0xDC, 0x49, 0x18, 0x27, 0xEA, 0xAF, 0x44, 0xBE, 0xDE, 0x3A, 0x26, 0x6D, 0x13, 0xFD, 0xA1, 0xFA,
+      0xD9, 0xF9, 0xC3, 0x2D, 0x36, 0x07, 0xA6, 0x64, 0x32, 0x79, 0x90, 0x3C, 0xC8, 0xDF, 0x71, 0x72,
+      0x47, 0x6E, 0x8C, 0xB1, 0xDE, 0xF5, 0xBB, 0x74, 0xD3, 0xED, 0x1B, 0xF4, 0x03, 0x3E, 0xF3, 0x5A,
+      0x48, 0xD4, 0xC2, 0x25, 0x84, 0x2D, 0x23, 0x08, 0x57, 0xE0, 0x69, 0x63, 0xFE, 0x10, 0x47, 0xCF,
+      0x69, 0xC9, 0xEB, 0x1C, 0x02, 0xE7, 0x88, 0xCB, 0x9B, 0x29, 0x35, 0x57, 0x9A, 0xA9, 0x81, 0x32,
+      0x19, 0x92, 0x10, 0x48, 0x80, 0x56, 0x15, 0x67, 0x34, 0x1E, 0x7F, 0xD2, 0x3C, 0x52, 0xE0, 0x38,
+      0xA6, 0x79, 0x2A, 0x21, 0xD1, 0xDF, 0x96, 0x24, 0x93, 0xD0, 0x08, 0xFF, 0x54, 0x14, 0x85, 0x3C,
+      0x3E, 0x5F, 0x11, 0x24, 0x4C, 0x0D, 0x1F, 0x75, 0xDB, 0xA5, 0x49, 0xE5, 0x0D, 0xB5, 0x93, 0xFA,
+      0x7A, 0x8F, 0xB3, 0x64, 0x36, 0x75, 0xB2, 0x47, 0x6F, 0x72, 0x96, 0xCC, 0xA6, 0x0C, 0x97, 0x29,
+      0xCD, 0x41, 0x5C, 0x7D, 0x2B, 0x53, 0x39, 0x61, 0xFC, 0xC5, 0x3B, 0x05, 0xE8, 0x40, 0xE3, 0x98,
+      0xE4, 0x7D, 0xB5, 0x94, 0x26, 0x09, 0x04, 0x39, 0x29, 0xD7, 0x8B, 0x03, 0xC1, 0xB1, 0xFC, 0x9F,
+      0x61, 0x9A, 0x1B, 0xCD, 0x1A, 0x86, 0x08, 0xD7, 0x82, 0xDB, 0x97, 0x9C, 0x74, 0x72, 0x59, 0x39,
+      0x3A, 0x99, 0xD6, 0xB7, 0xDC, 0x9D, 0x34, 0xDB, 0xD6, 0x1A, 0xED, 0x50, 0x0E, 0x4C, 0xE6, 0x8D,
+      0x18, 0xC7, 0xCD, 0x87, 0x8E, 0xF7, 0x02, 0x94, 0xF3, 0xDC, 0xA0, 0x6D, 0x03, 0x25, 0x36, 0xE7,
+      0xAD, 0xB0, 0xF7, 0xCA, 0x53, 0x7A, 0xCD, 0x08, 0xBA, 0xF5, 0xFD, 0x2F, 0x95, 0x00, 0xC0, 0x56,
+      0x50, 0x6E, 0xD5, 0x8B, 0x69, 0x55, 0x30, 0x0C, 0x56, 0x4F, 0x18, 0x31, 0x4C, 0xE4, 0x95, 0xF7,
+      0x52, 0xE2, 0x22, 0x40, 0xF2, 0xAF, 0x5E, 0xB4, 0xB0, 0xD6, 0xA0, 0x89, 0x16, 0x76, 0x00, 0x87,
+      0xAB, 0xCE, 0x3B, 0x68, 0x96, 0xAE, 0x9B, 0xC0, 0x85, 0x9B, 0xC6, 0xA6, 0x8D, 0xFD, 0x06, 0x62,
+      0x01, 0x24, 0x99, 0x5D, 0xD6, 0x77, 0x81, 0xB1, 0xBC, 0xB3, 0xA9, 0x93, 0x03, 0xC6, 0x2C, 0xDB,
+      0xD1, 0x78, 0x9E, 0xB4, 0x63, 0x53, 0xD0, 0xF5, 0xEE, 0xCE, 0x62, 0xB3, 0xB1, 0xAD, 0xEF, 0x76,
+      0x97, 0x5D, 0x59, 0x75, 0xB3, 0x46, 0xAF, 0x75, 0x9D, 0xA0, 0x5D, 0xDE, 0x09, 0x05, 0x28, 0x24,
+      0xFB, 0x66, 0x75, 0x2C, 0x82, 0x00, 0xC9, 0x57, 0x43, 0x4D, 0x03, 0x55, 0x92, 0x1A, 0x7D, 0xE7,
+      0x4A, 0xD5, 0xD3, 0x1D, 0xB8, 0x7E, 0xD0, 0x39, 0xF0, 0xD4, 0x77, 0xBE, 0x0E, 0x29, 0x8D, 0x38,
+      0xDF, 0xA9, 0x1C, 0xA8, 0x5C, 0xC8, 0xB1, 0x69, 0x11, 0xD3, 0x23, 0xEA, 0xA4, 0x88, 0xBE, 0x31,
+      0xDC, 0x8C, 0x96, 0x9E, 0xE0, 0x85, 0xCD, 0xAB, 0x0E, 0x5D, 0x81, 0x1D, 0x66, 0x34, 0xCD, 0xAF,
+      0x44, 0x8F, 0x79, 0x0A, 0xA3, 0x70, 0xDD, 0x5E, 0x43, 0x17, 0xD0, 0xDE, 0x50, 0xE7, 0xBA, 0x12,
+      0x25, 0xCF, 0xD3, 0x4E, 0xB6, 0x1A, 0x84, 0xF3, 0x37, 0xAD, 0xB1, 0x0D, 0xA1, 0xD4, 0x09, 0x63,
+      0x29, 0xED, 0xCB, 0x72, 0x7C, 0xEC, 0x04, 0x68, 0xEB, 0x42, 0xA3, 0x8A, 0x75, 0xC8, 0x45, 0x95,
+      0xC7, 0xF2, 0x0D, 0x4C, 0xFA, 0x13, 0x30, 0x07, 0x73, 0xCA, 0x77, 0xE8, 0xE7, 0x94, 0x15, 0x3C,
+      0x0A, 0xAD, 0x4C, 0xD5, 0xED, 0x1F, 0xC6, 0xD2, 0x51, 0x02, 0xE1, 0x8B, 0xC9, 0xF4, 0x90, 0xB3,
+      0x78, 0x22, 0x21, 0xAB, 0x02, 0x47, 0xD0, 0xC5, 0x12, 0xF1, 0x42, 0x2C, 0xCA, 0x19, 0xA5, 0xA1,
+      0x35, 0x12, 0x1C, 0x5A, 0x87, 0x07, 0xAB, 0xB3, 0x14, 0xA4, 0x66, 0x46, 0x16, 0x46, 0x2B, 0xA8,
+      0x41, 0xE2, 0x2C, 0xEB, 0x58, 0x0B, 0x2D, 0x3D, 0x80, 0x34, 0x4F, 0x30, 0xDA, 0x8F, 0x1C, 0x9A,
+      0x2B, 0x0C, 0x0E, 0x19, 0x8F, 0x9E, 0x7B, 0x08, 0xDC, 0xB1, 0x7F, 0xC1, 0x2B, 0x2A, 0xED, 0x17,
+      0x20, 0x68, 0xC4, 0xB0, 0x6C, 0xB8, 0xBF, 0x1E, 0x04, 0x85, 0x6E, 0x95, 0x5A, 0x93, 0xFD, 0xB5,
+      0xE4, 0x05, 0x04, 0x75, 0x6E, 0x6D, 0xA7, 0x04, 0x30, 0xB9, 0xD0, 0x88, 0xDF, 0x48, 0x62, 0x44,
+      0xE8, 0x08, 0xDB, 0xEC, 0xBA, 0x5A, 0x9F, 0x3E, 0x3B, 0x14, 0xE9, 0xE5, 0xA6, 0x0B, 0xF7, 0x6D,
+      0x21, 0xD2, 0x71, 0xEE, 0xED, 0x2C, 0xFE, 0x37, 0x5E, 0x53, 0x96, 0x77, 0x11, 0xA8, 0x31, 0x3F,
+      0x0E, 0x41, 0xBD, 0x5A, 0x58, 0xF3, 0xCB, 0xC0, 0xDD, 0x6E, 0x1E, 0x5A, 0x50, 0x3A, 0x40, 0x54,
+      0x7A, 0x2A, 0x96, 0xE4, 0xAB, 0xDB, 0x02, 0x60, 0xC2, 0xBA, 0x7D, 0xF7, 0x6F, 0x1E, 0xCD, 0x63,
+      0x02, 0x75, 0x75, 0x3B, 0x30, 0x7A, 0x10, 0x84, 0x24, 0xE1, 0x0D, 0x90, 0x83, 0x3B, 0x13, 0xCA,
+      0x18, 0x4A, 0x71, 0x01, 0xAF, 0x07, 0xF7, 0xC1, 0x6B, 0x21, 0x4C, 0x9E, 0x09, 0xCA, 0x78, 0x5D,
+      0x81, 0xBC, 0x0A, 0xEA, 0x91, 0x80, 0xEE, 0x13, 0x11, 0x00, 0x3C, 0xB8, 0x06, 0x8F, 0xEB, 0xAE,
+      0xC1, 0x04, 0xF7, 0x72, 0x79, 0x59, 0x0F, 0x93, 0xF0, 0xFA, 0xC6, 0x26, 0xB9, 0xA3, 0xA2, 0xE7,
+      0xC6, 0xA2, 0xB5, 0xA3, 0x83, 0x02, 0x9D, 0x90, 0x61, 0x00, 0x2F, 0xBD, 0x05, 0xC0, 0x99, 0xC9,
+      0x70, 0x03, 0xF5, 0xFE, 0x71, 0x2E, 0x78, 0x0A, 0xA6, 0x3A, 0x9C, 0xA5, 0xE4, 0x11, 0xF4, 0xC9,
+      0xEB, 0x45, 0x85, 0xB3, 0x62, 0x56, 0xA9, 0x1F, 0x6B, 0xD1, 0xAE, 0x87, 0xD5, 0xE5, 0x86, 0x6A,
+      0x66, 0x7E, 0x8E, 0x94, 0x28, 0xDF, 0x35, 0x4B, 0x4C, 0x04, 0xA6, 0xAC, 0xEA, 0xA3, 0xE2, 0xE6,
+      0xAE, 0xC5, 0x45, 0xBB, 0xA5, 0xAA, 0x33, 0xA0, 0xDB, 0x7E, 0x70, 0x02, 0xB4, 0xA2, 0xBA, 0xAC,
+      0xA4, 0xD4, 0x05, 0xA7, 0x1A, 0xF3, 0x24, 0x00, 0x6F, 0x01, 0xCC, 0x77, 0xF0, 0xB9, 0x83, 0xCF,
+      0x3D, 0x7C, 0xF6, 0xF0, 0x79, 0xDB, 0x80, 0xD3, 0x95, 0x9E, 0x0F, 0x18, 0xC0, 0x6B, 0x9F, 0xBB,
+      0x78, 0x1C, 0x34, 0xAA, 0x01, 0x99, 0x6B, 0x87, 0xBA, 0xE8, 0xE5, 0x6C, 0xDB, 0xB5, 0x9A, 0x14,
+      0xFD, 0x8E, 0x6F, 0xF3, 0xB0, 0x77, 0xFA, 0x28, 0x17, 0x11, 0xC7, 0x70, 0xBE, 0x6D, 0x5C, 0xFA,
+      0xD5, 0xE3, 0x52, 0xCB, 0x68, 0x47, 0xB7, 0x7E, 0xD3, 0xE8, 0x54, 0x1E, 0xC9, 0x58, 0x87, 0x94,
+      0xBC, 0x72, 0xC2, 0xAA, 0x1F, 0x8B, 0x1F, 0xF3, 0x1E, 0xED, 0x6C, 0xB4, 0x1B, 0x07, 0x00, 0x78,
+      0xA1, 0xA7, 0x21, 0x40, 0x56, 0x40, 0x98, 0x67, 0x2D, 0x9E, 0x4E, 0x44, 0x5F, 0xBF, 0xDF, 0xA8,
+      0xEA, 0x79, 0x29, 0xF0, 0xD1, 0xE0, 0x3A, 0xDA, 0x39, 0xBB, 0x43, 0x45, 0x45, 0x7F, 0x03, 0x3D,
+      0x4E, 0x00, 0xB8, 0x52, 0xFA, 0x8B, 0x15, 0xB5, 0xF5, 0xFB, 0x6E, 0x24, 0x2D, 0x4C, 0xA4, 0xA8,
+      0xD0, 0xBF, 0x52, 0xD2, 0x14, 0xE0, 0xEC, 0xCC, 0xA8, 0x2D, 0x67, 0x38, 0x98, 0x5B, 0x75, 0x3F,
+      0x35, 0x6D, 0x3D, 0x39, 0xDB, 0x5E, 0xCF, 0xDD, 0x09, 0xC9, 0x95, 0xE9, 0x63, 0xB0, 0x61, 0x89,
+      0xB5, 0x40, 0x4D, 0x3F, 0x87, 0x03, 0x7D, 0xBA, 0x65, 0xD3, 0x92, 0x32, 0x21, 0xAB, 0x5C, 0x7B,
+      0xB8, 0x71, 0xA3, 0x85, 0x18, 0x9C, 0x81, 0xAD, 0x56, 0x13, 0xAC, 0xC1, 0x83, 0xA4, 0x94, 0x72,
+      0x19, 0xFE, 0x6E, 0x6B, 0x3A, 0xC9, 0xBE, 0x7F, 0xA4, 0x32, 0x97, 0xBB, 0xEC, 0x00, 0x75, 0xEB,
+      0xA7, 0x7A, 0x3E, 0xDB, 0xEC, 0xAD, 0x17, 0x61, 0x0D, 0x2D, 0x4D, 0xDE, 0x99, 0x00, 0x66, 0x44,
+      0xCB, 0x35, 0xCB, 0xEA, 0x60, 0xD1, 0x27, 0x2D, 0x17, 0x0D, 0xFE, 0xBA, 0x51, 0x74, 0x33, 0x0A,
+      0x23, 0xDB, 0x36, 0xEF, 0xE4, 0x2C, 0xED, 0x2A, 0x74, 0x75, 0x1C, 0x6E, 0x1E, 0xF8, 0x14, 0xF7,
+      0xB6, 0x4C, 0x5C, 0x1F, 0x0E, 0x20, 0xFA, 0xD5, 0x8E, 0x6D, 0x1D, 0x37, 0xEE, 0xAD, 0x8B, 0x48,
+      0xE0, 0xE4, 0x81, 0x6D, 0xC9, 0x76, 0xA3, 0x2D, 0x99, 0xB3, 0x71, 0x0A, 0x04, 0x94, 0x20, 0x26,
+      0x78, 0x7A, 0xC3, 0xE2, 0x55, 0x9E, 0x9F, 0x82, 0x40, 0xF3, 0x72, 0x79, 0x22, 0x10, 0xBA, 0xC7,
+      0x3C, 0x17, 0x10, 0xA3, 0x07, 0xB5, 0x80, 0x33, 0xDF, 0x67, 0x38, 0x25, 0x0A, 0x68, 0x12, 0x9A,
+      0xD6, 0x83, 0x72, 0xE4, 0x8F, 0x1F, 0x7D, 0xE8, 0xAD, 0x97, 0x87, 0x73, 0xB3, 0x09, 0xFE, 0x45,
+      0xB8, 0x70, 0x4E, 0x0F, 0x66, 0x96, 0x01, 0x90, 0xED, 0x5B, 0x5E, 0x66, 0x4A, 0x34, 0x13, 0x72,
+      0x60, 0x18, 0x79, 0x74, 0x16, 0xAF, 0x17, 0x34, 0x2F, 0x6A, 0xD1, 0xDC, 0x5F, 0xED, 0xD7, 0xA7,
+      0x6A, 0xC5, 0xBC, 0x33, 0x94, 0x39, 0x02, 0xBB, 0x59, 0x90, 0x73, 0x39, 0x9D, 0x30, 0xFE, 0x42,
+      0x62, 0x27, 0x61, 0x3E, 0x58, 0x69, 0x9F, 0x46, 0xE1, 0xAF, 0x41, 0x5F, 0xE8, 0x81, 0xB3, 0xCF,
+      0xF5, 0x94, 0xE2, 0x13, 0x9A, 0x87, 0x0C, 0x66, 0xCA, 0xE9, 0xC3, 0x8B, 0xDE, 0x81, 0x47, 0xDB,
+      0x76, 0x4F, 0xCF, 0xFF, 0xFA, 0xAC, 0x7C, 0xD5, 0xDA, 0xAC, 0x33, 0x64, 0xB7, 0x6D, 0xE7, 0x38,
+      0x8E, 0x36, 0xCB, 0xF0, 0xB4, 0x0A, 0xA6, 0xF5, 0x82, 0xE1, 0x90, 0x30, 0x68, 0xC1, 0x09, 0x83,
+      0xA9, 0x7D, 0xBD, 0x90, 0x6F, 0xC6, 0x25, 0xC1, 0x17, 0xFA, 0x26, 0x07, 0xFF, 0x69, 0x7E, 0x20,
+      0x25, 0x15, 0xB3, 0x4D, 0x62, 0x5F, 0xFB, 0x41, 0x9C, 0x0B, 0xF2, 0xCD, 0x32, 0x3A, 0x90, 0xE8,
+      0x19, 0x5C, 0xB0, 0x7C, 0x5A, 0x77, 0xD6, 0xA5, 0xD3, 0xF8, 0xF2, 0xE9, 0xF2, 0x00, 0x3D, 0xC9,
+      0xEB, 0x2B, 0xA3, 0xD2, 0x08, 0x47, 0x4D, 0xBA, 0x3E, 0x98, 0x77, 0x6A, 0x99, 0x36, 0xF9, 0x8C,
+      0x46, 0x66, 0x6B, 0xFA, 0x98, 0xEE, 0x8B, 0xF3, 0x94, 0x34, 0xAA, 0x38, 0x3D, 0xD2, 0xFD, 0xC0,
+      0x13, 0x13, 0x2E, 0xF8, 0xDF, 0xA5, 0x43, 0xEF, 0xCC, 0x63, 0x6C, 0xC2, 0x31, 0x62, 0xB6, 0x07,
+      0xD9, 0xAE, 0x6E, 0x52, 0x50, 0xE9, 0xBA, 0x9E, 0xC0, 0x26, 0x06, 0x22, 0xCC, 0xA2, 0x1B, 0x09,
+      0x8B, 0xC8, 0x83, 0xC0, 0x7B, 0x0B, 0x0C, 0xDC, 0x00, 0x80, 0xED, 0x31, 0xCF, 0xD9, 0xD9, 0x79,
+      0xBC, 0x5D, 0xFB, 0x98, 0x63, 0x5F, 0xE0, 0xEC, 0x3A, 0xF7, 0x62, 0xE3, 0xDA, 0xA8, 0x6C, 0xFB,
+      0x57, 0x0D, 0xBC, 0x3F, 0xF3, 0xA2, 0x2E, 0x14, 0xF2, 0xC6, 0x14, 0x33, 0x9E, 0x7E, 0xAE, 0x78,
+      0xD4, 0x06, 0x61, 0x42, 0x4F, 0x24, 0x76, 0x22, 0x70, 0x2F, 0x8B, 0x50, 0x3B, 0xE4, 0x37, 0xB7,
+      0x02, 0xC2, 0xB0, 0x92, 0x70, 0x11, 0xE8, 0x4B, 0x08, 0x5D, 0x72, 0xE3, 0x01, 0x79, 0x8D, 0xE4,
+      0xDF, 0x55, 0x67, 0x4C, 0x6B, 0x9E, 0x6A, 0x8E, 0x2D, 0xD4, 0x37, 0x8F, 0x66, 0x7C, 0x97, 0x60,
+      0xAE, 0x6C, 0xA4, 0xBE, 0xCF, 0xF9, 0x3F, 0x98, 0x48, 0xAD, 0xC9, 0x21, 0xCB, 0x9D, 0x28, 0x2F,
+      0x0E, 0xED, 0xBD, 0xA2, 0xDC, 0xFF, 0x72, 0xA3, 0x3D, 0x97, 0x19, 0xCC, 0xA9, 0x63, 0x27, 0x3A,
+      0xA0, 0xB7, 0x56, 0x55, 0x40, 0x05, 0x36, 0x57, 0x87, 0xE6, 0xAA, 0x9C, 0xCA, 0x6C, 0x93, 0x32,
+      0xAF, 0x3A, 0xCD, 0xB5, 0xDC, 0x21, 0x0F, 0x66, 0xA5, 0x80, 0xDA, 0x3F, 0xA8, 0xED, 0x0C, 0x17,
+      0x15, 0xC8, 0x6F, 0xAF, 0xFE, 0xC0, 0x31, 0xF1, 0x72, 0x7B, 0xE4, 0x4A, 0x0F, 0xD6, 0x4F, 0x68,
+      0x59, 0x09, 0x2F, 0x3A, 0x50, 0x16, 0x77, 0x87, 0x0F, 0x88, 0x54, 0x75, 0xEA, 0x7C, 0x45, 0x98,
+      0x21, 0x47, 0x86, 0xA7, 0x19, 0xAA, 0xB6, 0xFA, 0xD5, 0x1C, 0x1D, 0x19, 0x1D, 0x8F, 0x8A, 0x78,
+      0x44, 0xF8, 0x79, 0x25, 0xD9, 0xF2, 0x08, 0x72, 0x59, 0xF9, 0xE4, 0xE3, 0x37, 0xE4, 0x48, 0xF2,
+      0xD5, 0xEB, 0x4E, 0xB7, 0x74, 0xAA, 0xFD, 0xBD, 0xE6, 0x42, 0xA7, 0x9A, 0x8A, 0xEE, 0x7F, 0xCB,
+      0xDB, 0x79, 0x65, 0xF9, 0xE4, 0x31, 0xF0, 0x14, 0xF9, 0x88, 0x01, 0x4C, 0x35, 0xD8, 0xD7, 0xBF,
+      0xBD, 0x6B, 0xBF, 0x65, 0x1F, 0xEF, 0x62, 0x9C, 0x5A, 0x32, 0x3B, 0xF8, 0x1D, 0x25, 0xF5, 0x77,
+      0x8C, 0xAF, 0x68, 0x9C, 0x67, 0xD8, 0xC4, 0x39, 0xD4, 0x98, 0x65, 0x91, 0xD1, 0xA6, 0xE9, 0xBF,
+      0xBE, 0xF8, 0x5A, 0xF2, 0x47, 0x23, 0x00, 0x00,
+    };
+    const uint32_t mvp_css_gz_size = 2184;
+    const char mvp_css_hash[] = "2137ba34cef15399";
+
+    //main.js gzipped
+    const uint8_t main_js_gz[] PROGMEM = {
+      0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x1A, 0x5D, 0x6F, 0xDB, 0x38,
+      0xF2, 0xDD, 0xBF, 0x82, 0x2B, 0xE0, 0xD6, 0xD2, 0xD5, 0x91, 0x93, 0xB4, 0x01, 0x0A, 0xBB, 0xD9,
+      0xC3, 0x66, 0x1B, 0xEC, 0xF5, 0x2E, 0xDB, 0x16, 0x4D, 0x7A, 0xF7, 0x60, 0x04, 0x06, 0x2D, 0xD1,
+      0xB6, 0xB6, 0xB2, 0xE8, 0x15, 0xA9, 0x38, 0xBE, 0x6D, 0xFE, 0xFB, 0xCD, 0x0C, 0x29, 0x89, 0x92,
+      0x65, 0x27, 0xD9, 0x1E, 0x70, 0xFB, 0xD2, 0x58, 0xE4, 0x7C, 0xCF, 0x70, 0x3E, 0xC8, 0x72, 0xB5,
+      0xCD, 0x22, 0x36, 0x2F, 0xB2, 0x48, 0x27, 0x32, 0x63, 0xC5, 0x3A, 0x95, 0x3C, 0x9E, 0x26, 0xAB,
+      0x85, 0x2F, 0xEE, 0x44, 0xA6, 0x83, 0xDE, 0xEF, 0x3D, 0xC6, 0xE8, 0x67, 0xB8, 0xCE, 0xE9, 0xEF,
+      0x5B, 0x31, 0xE7, 0x45, 0xAA, 0xFD, 0x60, 0x0C, 0x3B, 0x91, 0xCC, 0x94, 0x66, 0xF3, 0x24, 0x15,
+      0x8A, 0x9D, 0xB3, 0x58, 0x46, 0xC5, 0x0A, 0x41, 0x7F, 0x2B, 0x44, 0xBE, 0xBD, 0x16, 0xA9, 0x88,
+      0xB4, 0xCC, 0xFD, 0x7E, 0x92, 0xAD, 0x0B, 0x3D, 0xD1, 0xDB, 0xB5, 0x38, 0xF7, 0x10, 0xD6, 0xBB,
+      0xED, 0x07, 0x21, 0x21, 0x21, 0x8D, 0x64, 0xEE, 0xD3, 0xEF, 0x30, 0x15, 0xD9, 0x42, 0x2F, 0xD9,
+      0xF9, 0x39, 0x3B, 0x0E, 0x58, 0x2E, 0x74, 0x91, 0x67, 0xE3, 0x1E, 0x00, 0x0C, 0x87, 0x9C, 0xA9,
+      0x24, 0x5B, 0xA4, 0x82, 0x38, 0xB1, 0x44, 0x31, 0xCE, 0x72, 0xBE, 0x61, 0x1F, 0x3F, 0xDF, 0x30,
+      0x39, 0x67, 0x89, 0x56, 0x28, 0x88, 0x06, 0xCE, 0xDD, 0xE4, 0x4E, 0x02, 0x58, 0x47, 0x45, 0x4A,
+      0x81, 0x73, 0xA1, 0xD6, 0x20, 0x2F, 0xDF, 0xF0, 0x04, 0xA4, 0x17, 0x3A, 0x5A, 0xFA, 0x5E, 0xB2,
+      0xE2, 0x0B, 0x31, 0xF4, 0xD8, 0x0B, 0x26, 0xB2, 0x48, 0xC6, 0xE2, 0xF3, 0xA7, 0x77, 0x3F, 0xC9,
+      0xD5, 0x5A, 0x66, 0x40, 0xD6, 0x50, 0x9C, 0x1C, 0xDF, 0x86, 0x19, 0x5F, 0x89, 0x60, 0x60, 0x89,
+      0x31, 0xB6, 0x12, 0x7A, 0x29, 0xE3, 0x11, 0xF3, 0x40, 0x14, 0x6F, 0x60, 0x17, 0x97, 0x82, 0xC7,
+      0x22, 0x57, 0xA3, 0x12, 0x88, 0xB1, 0xFE, 0x4F, 0x46, 0xBC, 0xA3, 0x1B, 0xB0, 0x41, 0x7F, 0xC4,
+      0xFA, 0x7C, 0xBD, 0x4E, 0x93, 0x88, 0xA3, 0xCD, 0x87, 0x32, 0xD2, 0x42, 0x1F, 0x29, 0x9D, 0x0B,
+      0xBE, 0xEA, 0x5B, 0x94, 0x87, 0x92, 0xD6, 0x4C, 0xC6, 0xDB, 0x51, 0x29, 0x68, 0x29, 0x04, 0xCF,
+      0x73, 0xBE, 0xBD, 0x28, 0xE6, 0x73, 0x91, 0xFB, 0x01, 0x01, 0x3E, 0x90, 0x37, 0x48, 0xF9, 0xEF,
+      0x50, 0xB9, 0x50, 0x7E, 0x09, 0x18, 0x4F, 0x45, 0xAE, 0x7D, 0xEF, 0x33, 0xF9, 0x14, 0x0D, 0x85,
+      0xCA, 0x35, 0x34, 0x81, 0x6F, 0x8F, 0xCD, 0x39, 0x2C, 0xA1, 0x0E, 0xF0, 0x65, 0x18, 0x11, 0x05,
+      0x2D, 0xEE, 0xC1, 0xC9, 0xC1, 0x18, 0xCC, 0x2F, 0xC2, 0x45, 0xC8, 0x92, 0xEC, 0x8E, 0xA7, 0x49,
+      0xCC, 0xC8, 0x4E, 0x4C, 0xE6, 0x6C, 0x93, 0xCB, 0x6C, 0x01, 0x8E, 0xF9, 0x8F, 0x20, 0xD6, 0xA5,
+      0xC3, 0x40, 0x18, 0xE3, 0x34, 0x05, 0xE1, 0x92, 0xF3, 0xD4, 0x46, 0xC7, 0x42, 0x02, 0x05, 0x06,
+      0xD6, 0x64, 0x3C, 0x8F, 0x96, 0xC9, 0x9D, 0x18, 0xB1, 0x49, 0xF1, 0x9A, 0x91, 0x14, 0xC6, 0x53,
+      0xB7, 0x13, 0xFC, 0xB8, 0x9D, 0x14, 0x2F, 0x4F, 0xD9, 0xD5, 0x25, 0x11, 0xBE, 0x9D, 0x58, 0xBF,
+      0xDE, 0xB2, 0xB5, 0xC8, 0x89, 0x52, 0x15, 0x74, 0x6B, 0x9E, 0x6B, 0x0C, 0xBA, 0xC9, 0x2D, 0xF2,
+      0x9C, 0x43, 0x9C, 0xD5, 0xC1, 0x88, 0xCA, 0x12, 0xDB, 0xB6, 0xE3, 0x89, 0xDD, 0x39, 0xCB, 0xC4,
+      0x86, 0xDD, 0x80, 0x7E, 0x97, 0xE4, 0x69, 0x30, 0x62, 0x68, 0x7C, 0x4E, 0x7E, 0x36, 0x3E, 0x1E,
+      0x3B, 0x58, 0xC6, 0xA1, 0x16, 0xEF, 0x73, 0x92, 0xE9, 0xD7, 0x3F, 0xA2, 0x07, 0xFC, 0x13, 0xB0,
+      0x18, 0x02, 0x97, 0xA1, 0xF6, 0x82, 0xBD, 0xB2, 0x78, 0x06, 0x03, 0xCC, 0x8C, 0x48, 0x35, 0x84,
+      0xBB, 0x19, 0x2A, 0xA1, 0x7D, 0xDC, 0x1B, 0x40, 0x7C, 0x9A, 0x0D, 0x24, 0xFF, 0x96, 0x6B, 0xFE,
+      0xAF, 0x44, 0x6C, 0x7C, 0x0B, 0x35, 0x23, 0x37, 0x07, 0x08, 0x8D, 0x9C, 0x5F, 0x9E, 0xB6, 0xB9,
+      0x0E, 0x48, 0xD3, 0x10, 0xCD, 0x35, 0x60, 0x3A, 0x2F, 0x4A, 0xD1, 0xC9, 0x3E, 0xE1, 0xBA, 0x50,
+      0x4B, 0x4B, 0x6A, 0xE0, 0x84, 0x51, 0x33, 0x84, 0x02, 0xE3, 0xB5, 0x47, 0x4F, 0x87, 0xF2, 0xCA,
+      0xC8, 0xEF, 0x88, 0xFB, 0x76, 0xD4, 0x3F, 0x33, 0xE6, 0x6D, 0xC4, 0xBB, 0xF1, 0x8E, 0xE6, 0xB8,
+      0x48, 0xE5, 0xCC, 0x27, 0x55, 0x82, 0x9D, 0xB0, 0x37, 0x41, 0x7F, 0x20, 0xE4, 0x1F, 0x89, 0xEC,
+      0x1E, 0x04, 0x6A, 0x95, 0xF9, 0x62, 0xC8, 0x56, 0x5A, 0x4C, 0x49, 0x4F, 0x72, 0x8B, 0x49, 0x7D,
+      0x46, 0xFD, 0x3E, 0x2D, 0xF7, 0xDB, 0xDA, 0xF7, 0xDF, 0x5E, 0x5E, 0x5D, 0xDE, 0x5C, 0xF6, 0xFF,
+      0x80, 0x01, 0xEE, 0x8F, 0x36, 0x9B, 0xCD, 0x11, 0x44, 0xED, 0xEA, 0xA8, 0xC8, 0x53, 0x13, 0x7D,
+      0x71, 0x69, 0x09, 0xFC, 0xD7, 0xB1, 0x06, 0x45, 0xDD, 0xA7, 0xAB, 0x6B, 0x81, 0x27, 0xE7, 0x23,
+      0xCF, 0xF9, 0x4A, 0xF9, 0xBF, 0x5B, 0x91, 0x46, 0x14, 0x0A, 0x0F, 0xA5, 0x39, 0x5C, 0x8D, 0x72,
+      0x31, 0x07, 0x75, 0x97, 0x46, 0xA5, 0x69, 0x9A, 0x28, 0x50, 0x9A, 0x74, 0x1A, 0x0E, 0x37, 0x09,
+      0x44, 0xAB, 0x5E, 0x0A, 0xD4, 0x84, 0xC7, 0x10, 0x71, 0x03, 0xFA, 0x8A, 0x8A, 0x3C, 0x07, 0x81,
+      0x99, 0x50, 0x1A, 0x90, 0x34, 0x9C, 0x5A, 0x9E, 0xC3, 0xE9, 0x04, 0x4C, 0x11, 0x33, 0x2D, 0x65,
+      0x65, 0x0F, 0x1B, 0x0E, 0x7F, 0x43, 0xF4, 0xF3, 0x13, 0xCF, 0xE4, 0xA0, 0x10, 0x48, 0x64, 0x3E,
+      0x5A, 0x18, 0xA2, 0x08, 0x4E, 0xD9, 0x0F, 0xAC, 0xFC, 0x1D, 0xFE, 0xAA, 0x64, 0x06, 0x16, 0x77,
+      0xC0, 0x90, 0x29, 0x82, 0x94, 0xC6, 0x02, 0xE3, 0x33, 0xCD, 0x67, 0xA9, 0x70, 0xCB, 0xC8, 0x42,
+      0xE8, 0xCB, 0x54, 0xE0, 0xCF, 0x8B, 0xED, 0xBB, 0xD8, 0x72, 0x25, 0x4D, 0x3C, 0x1B, 0xE4, 0xCC,
+      0x20, 0x85, 0x49, 0x96, 0x89, 0xFC, 0xEF, 0x37, 0xBF, 0x5C, 0x01, 0x7A, 0xBF, 0x8F, 0x39, 0x8B,
+      0xFC, 0x09, 0x45, 0x83, 0x14, 0x13, 0xF7, 0x80, 0x83, 0x1F, 0x88, 0xDB, 0xB3, 0x98, 0x10, 0x38,
+      0x28, 0x45, 0x68, 0x74, 0x69, 0x54, 0x1F, 0x0B, 0x51, 0x27, 0x70, 0x14, 0x2F, 0x4E, 0xEE, 0x5C,
+      0xE1, 0x22, 0x88, 0x5D, 0x2D, 0xAC, 0x7C, 0x7E, 0x7F, 0xDD, 0xAF, 0x44, 0x62, 0x08, 0x1A, 0x82,
+      0xB7, 0x45, 0x16, 0xFF, 0xB4, 0x4C, 0xD2, 0xD8, 0x6F, 0x21, 0x61, 0xEA, 0x79, 0x8F, 0xE9, 0xC6,
+      0x7B, 0x2F, 0x99, 0x65, 0xEF, 0x05, 0x0E, 0xBE, 0x51, 0xAA, 0x41, 0x21, 0xB9, 0x73, 0xF6, 0xEB,
+      0x5C, 0x4B, 0x01, 0x53, 0x6A, 0x04, 0xE1, 0xC4, 0x7C, 0x14, 0x35, 0x01, 0x41, 0x8F, 0xC7, 0xF0,
+      0xE7, 0x0D, 0xDB, 0x55, 0x11, 0xD6, 0x5F, 0xBC, 0xE8, 0x56, 0xD1, 0x18, 0xD8, 0x26, 0x49, 0x07,
+      0x73, 0x92, 0x98, 0x7A, 0x31, 0x6E, 0x40, 0xEB, 0xFC, 0x80, 0x3D, 0x74, 0x8E, 0x06, 0x69, 0xC0,
+      0x97, 0x74, 0xF7, 0x61, 0xC4, 0xAE, 0x09, 0x29, 0xC3, 0x3D, 0xC5, 0x86, 0xB5, 0xCC, 0x81, 0xCB,
+      0x10, 0x9A, 0x06, 0x48, 0x5E, 0x45, 0x9A, 0xB2, 0x59, 0x9E, 0x2C, 0x96, 0x3A, 0x13, 0x4A, 0x0D,
+      0xD8, 0x31, 0x2B, 0x32, 0x9D, 0xA4, 0x14, 0x14, 0xB1, 0xB8, 0x4B, 0x22, 0xC1, 0x96, 0x5C, 0xC1,
+      0x4F, 0x3A, 0x7F, 0xB4, 0x4C, 0xF4, 0x1A, 0x72, 0x97, 0xC7, 0xE2, 0xA9, 0xA2, 0x37, 0x03, 0x0B,
+      0x6D, 0xB7, 0x16, 0xFC, 0xCB, 0x74, 0xC5, 0xD9, 0x0F, 0xD8, 0xD9, 0x58, 0x72, 0x4F, 0x52, 0x6E,
+      0x0F, 0x1D, 0x2C, 0xDB, 0xAB, 0x1F, 0x19, 0x7E, 0x0E, 0x28, 0xBB, 0xB5, 0xE0, 0xF8, 0xDD, 0xC2,
+      0x01, 0xE3, 0x58, 0x87, 0x17, 0xA2, 0x11, 0x61, 0x22, 0x55, 0xE2, 0x59, 0x92, 0x78, 0x36, 0x29,
+      0xC0, 0x29, 0x0A, 0x43, 0x13, 0xAD, 0x0D, 0x23, 0x29, 0x91, 0x4E, 0xE3, 0x27, 0x9B, 0xA8, 0xC4,
+      0x98, 0xE9, 0xEC, 0x00, 0x0E, 0x77, 0x51, 0x2C, 0xF8, 0xD3, 0x84, 0x55, 0xD4, 0x7B, 0x36, 0x34,
+      0x2E, 0xF1, 0x65, 0x16, 0x41, 0x16, 0xFE, 0x02, 0x6C, 0xFD, 0x80, 0x32, 0x10, 0x54, 0xD6, 0x69,
+      0x9C, 0xA8, 0x75, 0xCA, 0xB7, 0x22, 0xB6, 0x05, 0xC0, 0x09, 0xAA, 0x87, 0x26, 0x89, 0xB8, 0x21,
+      0x80, 0x25, 0xDA, 0x36, 0x46, 0xFC, 0x6C, 0x63, 0xC4, 0xCF, 0x33, 0x46, 0xFC, 0x1C, 0x63, 0x98,
+      0xD2, 0xD6, 0x30, 0x46, 0xBC, 0xCF, 0x18, 0x8D, 0x32, 0xD8, 0x6D, 0x85, 0x78, 0xC7, 0x0A, 0xF1,
+      0xAE, 0x15, 0x74, 0xDE, 0x80, 0x70, 0x5A, 0xAA, 0x8E, 0x5D, 0x1B, 0x87, 0xFB, 0x01, 0xC8, 0xF0,
+      0xFB, 0xB7, 0x63, 0xBB, 0x7D, 0x20, 0x7F, 0xEA, 0x3C, 0xA8, 0xD3, 0x65, 0xD9, 0x31, 0xEF, 0xAD,
+      0x96, 0xB6, 0x50, 0xC2, 0x41, 0x5E, 0x25, 0x79, 0x2E, 0xF3, 0x29, 0x34, 0x46, 0x19, 0x04, 0x94,
+      0x88, 0xAB, 0xC1, 0x04, 0x12, 0x0C, 0x95, 0x4C, 0x0E, 0x6D, 0xB1, 0x62, 0x6A, 0x29, 0x37, 0x8A,
+      0xD2, 0xC7, 0xD5, 0xE5, 0x5B, 0xC8, 0x33, 0x99, 0xD4, 0xF4, 0xA5, 0x60, 0xFE, 0x81, 0xBC, 0x42,
+      0x8D, 0x6B, 0xD5, 0x5F, 0x45, 0xFA, 0xFE, 0x50, 0x95, 0x6B, 0xC5, 0xA2, 0x17, 0x20, 0x04, 0xF5,
+      0x12, 0xD0, 0xB6, 0x78, 0xA7, 0xB1, 0x17, 0xD8, 0xA9, 0x08, 0xE6, 0x31, 0xEC, 0xC8, 0x39, 0x56,
+      0xE7, 0xAA, 0xA2, 0x5F, 0xDE, 0xF0, 0xC5, 0xA0, 0x4E, 0x64, 0x38, 0x2C, 0xC9, 0x2C, 0xDD, 0x02,
+      0xBB, 0x4D, 0x86, 0x4D, 0x11, 0xC0, 0xF2, 0x05, 0x87, 0x56, 0x3C, 0xC1, 0xC1, 0x89, 0xB2, 0x5F,
+      0xB4, 0xE4, 0xD9, 0x42, 0xC4, 0x75, 0x75, 0x6F, 0x4B, 0x00, 0x7D, 0x4F, 0xC4, 0xA3, 0x25, 0xB4,
+      0xEC, 0x5E, 0x26, 0x8F, 0xE8, 0xA7, 0xF7, 0xF0, 0x68, 0xD1, 0x9F, 0x61, 0xEB, 0xD6, 0x28, 0xFA,
+      0xB8, 0xE2, 0x16, 0xFD, 0xE1, 0x90, 0x5D, 0x61, 0x9F, 0xE6, 0xA6, 0x5C, 0x63, 0x22, 0x23, 0xBB,
+      0x69, 0xB8, 0xDF, 0x19, 0x8F, 0x94, 0xEE, 0xA3, 0x2D, 0x08, 0x5C, 0xEA, 0xF0, 0xAA, 0xB8, 0x75,
+      0xF2, 0x3E, 0x7B, 0x8B, 0xB3, 0xA1, 0x63, 0x81, 0x4C, 0x4B, 0x56, 0xFB, 0xAA, 0x82, 0x04, 0x37,
+      0x84, 0x51, 0x0A, 0x4D, 0xD5, 0x27, 0xF0, 0xAC, 0x7F, 0x0C, 0xC5, 0x61, 0x60, 0xD6, 0x08, 0x2C,
+      0xDC, 0x24, 0x31, 0x36, 0xD7, 0xCE, 0xCA, 0x52, 0x60, 0x21, 0x71, 0xC2, 0x10, 0xF7, 0x62, 0x60,
+      0xF6, 0xAE, 0x3E, 0x2D, 0x44, 0xE5, 0xD8, 0x81, 0x81, 0xC6, 0x2D, 0x04, 0x47, 0xC9, 0x2F, 0xE2,
+      0xC3, 0xEC, 0x57, 0x60, 0x04, 0xDF, 0x06, 0x32, 0x54, 0x79, 0x54, 0xC7, 0x64, 0x53, 0x3B, 0xD8,
+      0x02, 0xD5, 0x10, 0xD5, 0x9C, 0xE5, 0x1A, 0x15, 0x4D, 0x68, 0xB1, 0xF6, 0x45, 0xB0, 0x3D, 0x4D,
+      0xD3, 0xB2, 0x8B, 0xF3, 0xDD, 0x4E, 0xD6, 0x6B, 0xEF, 0x7E, 0x4B, 0xF3, 0xD6, 0x73, 0x3B, 0x08,
+      0xCC, 0x62, 0x25, 0xD1, 0x43, 0xE1, 0xBD, 0x2B, 0x40, 0xA9, 0x7B, 0xB9, 0x62, 0xBA, 0x39, 0xCC,
+      0x5F, 0x40, 0xC7, 0xBB, 0xB4, 0xAB, 0x71, 0x59, 0xAE, 0x46, 0x75, 0xC5, 0x3B, 0x5C, 0x0F, 0xBB,
+      0xAB, 0x60, 0xB7, 0xF1, 0xF0, 0x00, 0x4F, 0xE7, 0x6A, 0xAA, 0x34, 0xD7, 0x85, 0x22, 0x0D, 0x8D,
+      0xD9, 0xA8, 0xD1, 0x91, 0x1A, 0xE6, 0xD8, 0x03, 0x3A, 0x11, 0xC0, 0x14, 0x47, 0x30, 0xA3, 0x0D,
+      0x7D, 0x37, 0xD4, 0x20, 0x81, 0x6A, 0x30, 0x12, 0xEA, 0x9F, 0x17, 0x5B, 0xE8, 0xB1, 0x3D, 0x3A,
+      0xCD, 0xC8, 0x86, 0xA7, 0xA9, 0x8C, 0x48, 0xD3, 0x03, 0xAC, 0x2A, 0x20, 0x87, 0x5D, 0xB5, 0xB6,
+      0xCB, 0xB2, 0x09, 0xDE, 0xC9, 0x16, 0xA2, 0x46, 0x4C, 0x61, 0x78, 0x59, 0x1F, 0x62, 0x5B, 0x01,
+      0x19, 0x8E, 0xD5, 0xE7, 0x2E, 0xC7, 0x9A, 0x1C, 0x32, 0x2B, 0x79, 0xED, 0xD8, 0x1A, 0xAA, 0x2E,
+      0xF6, 0x12, 0xAE, 0xA9, 0xA1, 0x69, 0x97, 0x59, 0x5F, 0xB3, 0x95, 0xBC, 0x13, 0x8C, 0x33, 0x05,
+      0xB9, 0x0D, 0xA6, 0xEE, 0xCD, 0x92, 0xEE, 0x7C, 0x74, 0x5F, 0xB1, 0x99, 0xC0, 0x1E, 0x1E, 0x4E,
+      0xDC, 0xC2, 0xA4, 0x2B, 0x94, 0xBE, 0xEE, 0xEE, 0x0E, 0x89, 0x5F, 0x43, 0x4D, 0x73, 0x4C, 0x76,
+      0x5E, 0x39, 0x3A, 0x56, 0x18, 0x1C, 0x64, 0xBB, 0x2B, 0xAB, 0x2D, 0xFB, 0xEE, 0xDC, 0x21, 0x5C,
+      0x5F, 0x22, 0xD4, 0x6B, 0x21, 0xA4, 0xDE, 0xA2, 0xEA, 0x92, 0xEB, 0x75, 0x13, 0x5D, 0x4F, 0x91,
+      0x23, 0xE5, 0x33, 0x91, 0x42, 0x72, 0x6F, 0x04, 0xFB, 0x45, 0xB5, 0xEF, 0x44, 0xB9, 0xA3, 0x22,
+      0x98, 0xF4, 0x2F, 0x5E, 0x39, 0xAD, 0xA3, 0xFA, 0x2B, 0x7E, 0x3F, 0xED, 0xE8, 0x4F, 0xDB, 0x7C,
+      0x1D, 0xB0, 0x27, 0x1B, 0xC0, 0xC1, 0xA9, 0x2D, 0xE0, 0x2C, 0x36, 0x4D, 0xE0, 0x6C, 0x3C, 0x62,
+      0x03, 0x57, 0x96, 0x4E, 0x23, 0xFC, 0xC2, 0xEF, 0x3B, 0xCE, 0xBA, 0xAB, 0xA9, 0x39, 0xD2, 0xD6,
+      0x10, 0x6E, 0x68, 0xD1, 0xED, 0x25, 0x94, 0x90, 0x79, 0xB2, 0xA8, 0x86, 0x5D, 0x4C, 0xFD, 0x6B,
+      0x2A, 0x04, 0x1A, 0xFA, 0x88, 0x39, 0x56, 0x44, 0x3C, 0xE5, 0x49, 0x34, 0x70, 0xC6, 0x00, 0x88,
+      0x2E, 0x52, 0xC7, 0x8E, 0xBC, 0xA6, 0x50, 0x42, 0x77, 0x04, 0x09, 0x3D, 0x85, 0xE3, 0x93, 0xDB,
+      0x22, 0x69, 0xB6, 0xF1, 0x52, 0x05, 0xEB, 0xA8, 0x32, 0x37, 0xA3, 0xAA, 0xCE, 0xAE, 0x8B, 0x22,
+      0xB1, 0xEC, 0xBF, 0x21, 0xAF, 0x36, 0xD2, 0xAA, 0x6D, 0x19, 0x4C, 0x9B, 0xF1, 0x9C, 0xAE, 0x61,
+      0x5C, 0x8F, 0xB9, 0x6E, 0x45, 0x43, 0xCF, 0x92, 0x3D, 0xCD, 0xD7, 0xD7, 0xAF, 0xAC, 0x51, 0xDD,
+      0xAA, 0x6D, 0x5B, 0xEC, 0x76, 0xC6, 0xC4, 0x06, 0x2D, 0x97, 0xD4, 0xB8, 0x0D, 0x62, 0x09, 0x36,
+      0xE8, 0xB9, 0x23, 0x6C, 0xA3, 0xDF, 0x6A, 0x36, 0x67, 0xAC, 0x2B, 0x47, 0x8C, 0xDD, 0xAD, 0x56,
+      0xAA, 0xDE, 0x93, 0xD4, 0x3B, 0x3A, 0xFB, 0x9D, 0xAB, 0x9D, 0x16, 0xC0, 0xEE, 0x25, 0xCF, 0xC7,
+      0x0F, 0xD7, 0x37, 0xFF, 0x9F, 0x2B, 0x9E, 0xB6, 0x68, 0x07, 0x2E, 0x7B, 0x9C, 0xC4, 0x62, 0xDB,
+      0x39, 0xBF, 0xAE, 0x5F, 0x6B, 0x91, 0x47, 0x8F, 0x24, 0x88, 0xDD, 0x04, 0x69, 0x8E, 0x37, 0x1A,
+      0xF6, 0x7F, 0x96, 0xCD, 0x4A, 0x39, 0xAA, 0x2C, 0x66, 0x5D, 0x80, 0x7E, 0xAA, 0x69, 0xFD, 0x99,
+      0x3C, 0xE0, 0x48, 0x35, 0x2A, 0xC5, 0xEF, 0xB4, 0xBF, 0x9B, 0xD4, 0x76, 0x1D, 0xF0, 0xC7, 0x32,
+      0xF4, 0x13, 0x3C, 0xF0, 0xFC, 0x5C, 0xDA, 0x91, 0x42, 0x1D, 0x2F, 0x38, 0xF4, 0xFE, 0x4C, 0x6E,
+      0x70, 0xC5, 0x1A, 0x95, 0x2A, 0xB8, 0x7E, 0xA0, 0x52, 0xD8, 0x1A, 0xD5, 0x40, 0xFD, 0x39, 0x4F,
+      0x15, 0x18, 0xB0, 0x76, 0x93, 0xDD, 0x9C, 0x1A, 0xD8, 0x46, 0x89, 0xB0, 0xD7, 0x41, 0x94, 0xDB,
+      0xCD, 0x28, 0x57, 0x1D, 0x3F, 0x68, 0x77, 0xE0, 0xDC, 0x41, 0x10, 0x73, 0x73, 0xA3, 0x44, 0x9F,
+      0x30, 0xD4, 0xE5, 0x4A, 0x53, 0x0D, 0xC9, 0xCC, 0x88, 0x45, 0x33, 0x86, 0xF1, 0x3D, 0x5B, 0x27,
+      0xF7, 0x22, 0x55, 0xBD, 0x6F, 0xCC, 0xDF, 0xEE, 0xBC, 0x68, 0xB3, 0xEA, 0xEE, 0x2C, 0x58, 0x76,
+      0x71, 0xF6, 0x69, 0x03, 0x04, 0x1C, 0xD7, 0xB3, 0xA6, 0x92, 0xD1, 0x17, 0xA1, 0xED, 0x24, 0xF5,
+      0x6F, 0x31, 0xBB, 0xA6, 0x6F, 0xDF, 0xDB, 0xA8, 0xD1, 0x90, 0x1E, 0xBB, 0xA8, 0x3D, 0x04, 0xD3,
+      0x84, 0x4B, 0xA9, 0x28, 0x2A, 0x86, 0x44, 0xC9, 0x3C, 0x3B, 0x18, 0xF2, 0x86, 0x46, 0x38, 0x4B,
+      0x32, 0x9E, 0x6F, 0xD1, 0xC1, 0x18, 0x58, 0x74, 0x19, 0x6F, 0xA1, 0x1C, 0x20, 0x99, 0x49, 0x18,
+      0xBA, 0xAB, 0xB9, 0xAC, 0xC3, 0x27, 0xF8, 0x44, 0xD1, 0x40, 0x88, 0x52, 0x89, 0x95, 0xB1, 0x31,
+      0xC9, 0xED, 0xF7, 0xE5, 0xDE, 0xDA, 0x01, 0xE1, 0x7B, 0x93, 0xAC, 0x84, 0x2C, 0xB4, 0xDF, 0xF4,
+      0xF2, 0x80, 0x9D, 0x1D, 0x1F, 0x9B, 0x91, 0xEC, 0xA1, 0xC1, 0x18, 0x5C, 0xAA, 0xCC, 0x98, 0xE9,
+      0x0B, 0x87, 0xB7, 0x31, 0x9C, 0xA9, 0xC5, 0xED, 0x17, 0x1F, 0x11, 0x3A, 0xE5, 0xC6, 0xDE, 0xF3,
+      0xD1, 0x2B, 0x0F, 0xBD, 0x59, 0x0E, 0x87, 0x75, 0x78, 0x8C, 0x18, 0xBE, 0x77, 0x0E, 0x98, 0x1D,
+      0x23, 0x4D, 0xF9, 0x1B, 0xB0, 0x4F, 0x3F, 0x5F, 0xD4, 0xB1, 0xD1, 0xAE, 0xF2, 0x6E, 0x51, 0x9D,
+      0x9C, 0xDC, 0xB2, 0xAF, 0xCC, 0x30, 0x38, 0xBD, 0x65, 0x6F, 0xDE, 0xB0, 0xD7, 0x55, 0x05, 0x2C,
+      0x5F, 0xA5, 0x9C, 0xFA, 0x3A, 0x79, 0x59, 0x83, 0xBF, 0x6A, 0x81, 0x97, 0xA1, 0x41, 0xA3, 0x2C,
+      0xCD, 0x93, 0x34, 0xB0, 0xE2, 0x4B, 0x93, 0xDF, 0x10, 0xAF, 0xC6, 0x80, 0xB3, 0xD1, 0xBA, 0x47,
+      0x36, 0xB2, 0xFD, 0xD5, 0x42, 0xEE, 0xB9, 0x43, 0x26, 0x4E, 0x64, 0x22, 0x7A, 0xDD, 0x32, 0x3F,
+      0x8A, 0x19, 0xC5, 0x8A, 0x7F, 0x06, 0xD1, 0xF5, 0x12, 0x28, 0x24, 0x03, 0xF6, 0xBA, 0xFC, 0x19,
+      0x0C, 0xD8, 0x2B, 0xFA, 0x3B, 0xEE, 0xA0, 0x31, 0xA1, 0x2D, 0x04, 0xC5, 0x67, 0xB4, 0xD3, 0xB3,
+      0xB3, 0xD6, 0x0D, 0x4E, 0xAF, 0xBA, 0xC8, 0x6C, 0x7A, 0xE2, 0x84, 0x7D, 0xFF, 0xBD, 0x21, 0x13,
+      0x98, 0x87, 0x00, 0xCD, 0x4B, 0x6F, 0xF8, 0x49, 0x16, 0x8B, 0x7B, 0x70, 0xC3, 0x80, 0xFD, 0x3C,
+      0x60, 0x17, 0x01, 0x3E, 0x14, 0x76, 0x1E, 0xDB, 0x5A, 0x2B, 0xD7, 0x16, 0x27, 0x63, 0x92, 0xE7,
+      0x8C, 0xBD, 0xB1, 0x5D, 0x4D, 0x75, 0xA3, 0xCE, 0x5E, 0x9C, 0xB3, 0xB3, 0x8E, 0x6E, 0xC9, 0xDC,
+      0x66, 0x20, 0xD3, 0xD2, 0x51, 0x49, 0xED, 0x28, 0xA4, 0x75, 0xD2, 0x72, 0xD6, 0x23, 0x46, 0x44,
+      0x94, 0xD3, 0x81, 0x91, 0xA2, 0x34, 0x1E, 0x52, 0x0F, 0xBA, 0x6C, 0x83, 0x4F, 0xE1, 0xC6, 0x0C,
+      0xE8, 0xFA, 0x75, 0xA1, 0x6B, 0xBF, 0xD3, 0xBA, 0x73, 0x59, 0xF1, 0x40, 0x69, 0x74, 0x6F, 0x76,
+      0xB2, 0xFF, 0x2F, 0x00, 0x73, 0x38, 0x54, 0x18, 0x50, 0xAA, 0x98, 0xAD, 0x12, 0x8C, 0xBD, 0xFA,
+      0x3F, 0x0C, 0x8C, 0x7B, 0x8D, 0xE6, 0x7B, 0xDC, 0x6B, 0xE7, 0x5A, 0xC8, 0x4A, 0x5D, 0x99, 0x16,
+      0x5F, 0x89, 0xB7, 0xD6, 0x01, 0x74, 0x71, 0xB6, 0xC4, 0x21, 0x0F, 0x9A, 0xF4, 0xB5, 0x4C, 0x53,
+      0x70, 0x89, 0x8F, 0x28, 0x9B, 0xA5, 0x4C, 0x05, 0xB5, 0xED, 0x74, 0xA3, 0x65, 0x1B, 0x70, 0x48,
+      0xE8, 0xD0, 0x5A, 0x07, 0x96, 0x51, 0xD0, 0x33, 0xD6, 0x36, 0x3D, 0xB9, 0x3D, 0xBB, 0x97, 0xF8,
+      0x71, 0x2D, 0x0B, 0xA8, 0xDC, 0xBE, 0x67, 0x76, 0x30, 0xA9, 0x99, 0x5F, 0x21, 0x8F, 0x63, 0x02,
+      0xB8, 0xC2, 0x27, 0x2E, 0xA8, 0x9A, 0x4E, 0x1A, 0xF6, 0x06, 0x4E, 0x42, 0xEA, 0x48, 0x38, 0xFB,
+      0x6F, 0x5B, 0xC0, 0x92, 0x87, 0x38, 0x40, 0xBA, 0xE5, 0xA9, 0x5C, 0x54, 0xF4, 0xBB, 0x9E, 0xE9,
+      0x0E, 0xE1, 0x97, 0x4D, 0x31, 0x12, 0xA8, 0xD3, 0x56, 0xB3, 0x5F, 0xFE, 0xC7, 0xF5, 0x87, 0xF7,
+      0xE1, 0x9A, 0xE7, 0x4A, 0x94, 0x19, 0xEB, 0xDB, 0x64, 0xC6, 0x6B, 0x4C, 0x73, 0x11, 0x68, 0x59,
+      0xB6, 0x7A, 0xF0, 0x0E, 0x7E, 0xC1, 0xF8, 0xBF, 0xEF, 0x58, 0xEE, 0xB3, 0x5B, 0x22, 0x00, 0x00,
+    };
+    const uint32_t main_js_gz_size = 2624;
+    const char main_js_hash[] = "4715461f8ad64704";
+
+    //index.html gzipped
+    const uint8_t index_html_gz[] PROGMEM = {
+      0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xAD, 0x56, 0xDB, 0x8E, 0xDB, 0x36,
+      0x10, 0x7D, 0xCF, 0x57, 0x30, 0x7C, 0x08, 0x12, 0x60, 0x6D, 0xF9, 0x96, 0x6C, 0xB2, 0x2B, 0xB9,
+      0xC0, 0xE6, 0x02, 0x14, 0x6D, 0x91, 0x05, 0xDA, 0x02, 0x9B, 0x27, 0x81, 0x96, 0xC6, 0x16, 0x53,
+      0x8A, 0x24, 0x48, 0xCA, 0x59, 0xF7, 0xEB, 0x3B, 0x24, 0x65, 0x9B, 0x56, 0xEC, 0x66, 0x81, 0xF6,
+      0x49, 0x9C, 0xE1, 0x99, 0xDB, 0xE1, 0x0C, 0xC5, 0xFC, 0xF9, 0x87, 0xCF, 0xEF, 0xFF, 0xF8, 0x72,
+      0xFF, 0x91, 0x34, 0xAE, 0x15, 0xCB, 0x67, 0x79, 0xFC, 0x10, 0x92, 0x37, 0xC0, 0x6A, 0xBF, 0xC0,
+      0x65, 0x0B, 0x8E, 0x91, 0xAA, 0x61, 0xC6, 0x82, 0x2B, 0x68, 0xE7, 0xD6, 0xA3, 0xB7, 0x94, 0x64,
+      0xFD, 0xA6, 0xE3, 0x4E, 0xC0, 0xF2, 0xFE, 0xE7, 0x87, 0x8F, 0xBF, 0x92, 0xBB, 0xCF, 0x0F, 0x79,
+      0x16, 0x15, 0x71, 0x53, 0x70, 0xF9, 0x17, 0x31, 0x20, 0x0A, 0x6A, 0xDD, 0x4E, 0x80, 0x6D, 0x00,
+      0x1C, 0x25, 0x8D, 0x81, 0x75, 0x41, 0xDB, 0xAD, 0x1E, 0x57, 0xD6, 0xFE, 0xB4, 0x2D, 0x66, 0xD3,
+      0xF9, 0xF5, 0x8A, 0xCD, 0x17, 0x15, 0xAC, 0xA7, 0xAF, 0xE7, 0xEF, 0xDE, 0xD1, 0x34, 0xAE, 0x64,
+      0x2D, 0x14, 0x74, 0xCB, 0xE1, 0x9B, 0x56, 0x06, 0x8D, 0x2B, 0x25, 0x1D, 0x48, 0xCC, 0xE3, 0x1B,
+      0xAF, 0x5D, 0x53, 0xD4, 0xB0, 0xE5, 0x15, 0x8C, 0x82, 0x70, 0x45, 0xB8, 0xE4, 0x8E, 0x33, 0x31,
+      0xB2, 0x15, 0x13, 0x50, 0x4C, 0xC7, 0x93, 0xE0, 0x2A, 0xCF, 0xF6, 0xC5, 0xE4, 0x2B, 0x55, 0xEF,
+      0x7A, 0xEF, 0x5E, 0x07, 0x26, 0x0A, 0x5E, 0x9C, 0xA6, 0x45, 0xA0, 0x14, 0x51, 0x59, 0x0A, 0xCB,
+      0x5B, 0xC6, 0xE5, 0xC1, 0xC2, 0x42, 0xE5, 0xB8, 0x3A, 0xC8, 0xDE, 0xC7, 0x6C, 0xF9, 0x81, 0x5B,
+      0x2D, 0xD8, 0x0E, 0x6A, 0xC2, 0x5B, 0xB6, 0x01, 0xB4, 0x9F, 0x25, 0x00, 0x7D, 0x5C, 0xA3, 0xB4,
+      0xE6, 0x9B, 0xCE, 0x40, 0xAA, 0x42, 0x65, 0xC5, 0xE4, 0x96, 0x59, 0xC2, 0xEB, 0x82, 0xD6, 0x7B,
+      0x5F, 0x65, 0xF0, 0x45, 0x49, 0x2C, 0x99, 0x22, 0xFB, 0x0D, 0xF0, 0x4D, 0xE3, 0xC2, 0x32, 0x30,
+      0xDB, 0xD3, 0x71, 0x43, 0x66, 0x8B, 0x89, 0x7E, 0xBC, 0xED, 0xF7, 0x6F, 0x08, 0xEB, 0x9C, 0xBA,
+      0x25, 0x2B, 0x65, 0xB0, 0x86, 0x51, 0x40, 0xDE, 0x10, 0xAB, 0x04, 0xAF, 0x0F, 0xCA, 0xDE, 0x6E,
+      0xEA, 0xAD, 0x42, 0x98, 0x91, 0x01, 0x89, 0x1B, 0x5C, 0x6E, 0x6E, 0x88, 0xE6, 0x8F, 0x20, 0x98,
+      0x83, 0xFA, 0xCC, 0x5E, 0x65, 0x30, 0xBD, 0x11, 0xD4, 0x1B, 0xB0, 0xB7, 0x74, 0x99, 0x67, 0x31,
+      0xF1, 0x93, 0x02, 0xB3, 0xBE, 0x42, 0x5C, 0x1F, 0x39, 0xC8, 0x74, 0x4A, 0x48, 0x28, 0xB4, 0xEA,
+      0x0C, 0x3A, 0x76, 0x25, 0x58, 0x87, 0x61, 0x1C, 0x78, 0x77, 0x07, 0x54, 0x9E, 0x0D, 0x88, 0x3E,
+      0x4F, 0xFC, 0x9F, 0x5A, 0x28, 0xF6, 0x24, 0xD6, 0x95, 0x69, 0x43, 0xD4, 0x2E, 0x58, 0x94, 0x5E,
+      0xA6, 0x04, 0x7B, 0xAD, 0x51, 0xA8, 0xD4, 0xCA, 0x62, 0x93, 0x11, 0x25, 0x6D, 0xB7, 0x6A, 0xB9,
+      0x3B, 0xA0, 0x78, 0xBB, 0x79, 0xF9, 0x8A, 0x2E, 0x8F, 0x7E, 0x4E, 0x4F, 0x8D, 0x4B, 0xDD, 0x39,
+      0xE2, 0x76, 0x1A, 0x4F, 0x62, 0xCD, 0x05, 0x9E, 0x55, 0xEC, 0x5B, 0x34, 0x2B, 0xA3, 0xCC, 0xAA,
+      0x0A, 0x34, 0xFA, 0x1B, 0x6B, 0xB9, 0xB9, 0x1A, 0x6F, 0xF8, 0x1A, 0x63, 0x76, 0xC2, 0x71, 0x2D,
+      0x86, 0x1D, 0x90, 0xFA, 0x8A, 0x59, 0xD0, 0x90, 0xEF, 0x7E, 0xBD, 0x65, 0xA2, 0xC3, 0xAD, 0x58,
+      0x30, 0x1D, 0x10, 0x8E, 0xC5, 0x2C, 0xCF, 0x71, 0xFD, 0x44, 0x16, 0x7F, 0x77, 0xCA, 0xEC, 0x7B,
+      0xD7, 0xFE, 0x2B, 0x8D, 0x8E, 0xAD, 0x04, 0x84, 0xBC, 0x02, 0xB8, 0x14, 0x1C, 0x89, 0x3B, 0x4D,
+      0x26, 0x40, 0x4E, 0xB3, 0x19, 0xB0, 0xF7, 0xD4, 0xAC, 0xC0, 0x39, 0xEC, 0x39, 0xFB, 0xB4, 0x73,
+      0xB5, 0x3D, 0x3A, 0x9E, 0xEC, 0x80, 0x5C, 0xC1, 0x56, 0x20, 0x02, 0x6C, 0x65, 0xFC, 0x88, 0x48,
+      0xB0, 0xB6, 0x0C, 0x4A, 0x4A, 0x10, 0x7F, 0xA2, 0x36, 0x4C, 0xE2, 0xD4, 0x2D, 0xEF, 0x0E, 0x9A,
+      0x3C, 0x0B, 0xC8, 0xB3, 0xE7, 0x35, 0x70, 0x19, 0x6D, 0xFB, 0x53, 0xEC, 0x05, 0x25, 0x03, 0xF4,
+      0x04, 0x87, 0xD7, 0x2A, 0xEE, 0xD5, 0xD8, 0x5B, 0xA4, 0xE5, 0xB2, 0xA0, 0x13, 0xFC, 0xB2, 0xC7,
+      0x82, 0x4E, 0x27, 0x13, 0x3F, 0xDA, 0xA0, 0xFD, 0xD2, 0xCF, 0x43, 0x30, 0xBD, 0x58, 0x0C, 0xDA,
+      0x94, 0xFB, 0x29, 0x4A, 0xAB, 0x49, 0xF5, 0x7D, 0x39, 0xBF, 0xB1, 0x47, 0xD2, 0xAB, 0x7E, 0x54,
+      0xCF, 0xF7, 0xD6, 0x17, 0x0A, 0x4A, 0x81, 0x97, 0x2A, 0x9A, 0x4F, 0x8E, 0x25, 0xE1, 0xFA, 0x6C,
+      0x4D, 0xFF, 0xB5, 0x81, 0x4F, 0xAE, 0xF4, 0xB4, 0xA7, 0xB1, 0x43, 0xC9, 0x0B, 0x1C, 0xF2, 0x56,
+      0x99, 0xDD, 0xA0, 0x8B, 0xB2, 0xA1, 0x55, 0xCE, 0x2C, 0xAF, 0x87, 0x43, 0xD9, 0xCC, 0x0F, 0x7E,
+      0x2C, 0xFF, 0xDB, 0xDF, 0x30, 0xF3, 0x01, 0x22, 0x5E, 0x65, 0x4E, 0x39, 0x26, 0x4A, 0x0F, 0xA1,
+      0xCB, 0x11, 0xF9, 0xE5, 0x6E, 0xE7, 0xFC, 0x1C, 0xA5, 0x57, 0x5E, 0x36, 0x70, 0xFF, 0x7D, 0xB8,
+      0x34, 0x58, 0x67, 0xA1, 0x1E, 0x06, 0xEB, 0x43, 0x31, 0x21, 0x54, 0xE5, 0x2F, 0xE7, 0xFF, 0x21,
+      0xDC, 0x27, 0x03, 0x70, 0xA4, 0xE7, 0x5C, 0xB4, 0x35, 0x22, 0x4A, 0xA4, 0x4A, 0xFB, 0x40, 0x97,
+      0xE3, 0x5C, 0x9C, 0xED, 0x3C, 0x3B, 0xFE, 0x3C, 0x71, 0x56, 0x95, 0x4B, 0xFE, 0xBD, 0xA9, 0x1F,
+      0xDB, 0x62, 0x5D, 0x69, 0xFC, 0xD9, 0x64, 0x36, 0xBB, 0x22, 0xEF, 0xEF, 0x1F, 0x92, 0x58, 0x27,
+      0xA0, 0x43, 0x1E, 0xBE, 0x7B, 0x82, 0xDF, 0x3E, 0x87, 0xDC, 0xE2, 0x3F, 0x4A, 0x3B, 0x62, 0x4D,
+      0xE5, 0x5B, 0x94, 0xCB, 0xF1, 0x57, 0xFF, 0xDC, 0x58, 0x5C, 0x4F, 0x5F, 0x2F, 0xDE, 0x4C, 0xD7,
+      0x6F, 0x59, 0xFD, 0x66, 0x71, 0x3D, 0x59, 0xF8, 0x4E, 0x8C, 0xC8, 0xF8, 0x58, 0x88, 0x6F, 0x04,
+      0xA4, 0xC1, 0x3F, 0x85, 0xFE, 0x01, 0xCE, 0x76, 0xE6, 0x60, 0x21, 0x09, 0x00, 0x00,
+    };
+    const uint32_t index_html_gz_size = 846;
+    const char index_html_hash[] = "d4fe95b86f6d00ba";
+  }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "anim.hpp"
+#include "catalog.hpp"
+
+#define IMAGE_CACHE_SLOTS         8      //max number of decoded images kept
+#define IMAGE_CACHE_BUDGET        16384  //default max heap used by decoded images in bytes
+#define IMAGE_CACHE_MIN_FREE_HEAP 12288  //the cache never lets the free heap go below this (except for the displayed image)
+
+namespace pixelbox
+{
+  namespace image_cache
+  {
+    typedef struct stats_s
+    {
+      uint32_t hits;
+      uint32_t misses;
+      uint32_t evictions;
+      uint32_t used_bytes;   //heap used by the cached animations
+      uint32_t entries;
+    } stats_s;
+
+    //LRU cache of decoded images, keyed by filename and catalog stamp (changes on every write of the file)
+
+    anim::animation_s* get(const String& name, uint32_t stamp);  //cached decoded image or NULL, no flash read, no decode
+    anim::animation_s* put(const String& name, uint32_t stamp, anim::animation_s* decoded); //takes over the decoded data (decoded is zeroed), evicts LRU entries if needed
+    bool contains(const String& name, uint32_t stamp);
+    void pin(anim::animation_s* anim); //pinned (displayed) image is never evicted, only one image is pinned
+    void remove(const String& name);
+
+    void set_budget(uint32_t bytes);
+    uint32_t get_budget();
+    stats_s get_stats();
+  }
+}
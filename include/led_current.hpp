@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+//current draw model of one WS2812b LED at full brightness (same values FastLED's power manager uses)
+//no Arduino dependency, shared with the host tools (tools/assets)
+#define LED_CURRENT_RED_MA    16
+#define LED_CURRENT_GREEN_MA  11
+#define LED_CURRENT_BLUE_MA   15
+#define LED_CURRENT_IDLE_MA   1
+
+namespace pixelbox
+{
+  namespace led_current
+  {
+    //estimated current draw (mA) of pixels_size pixels from their summed channels, scaled only once (same model as FastLED's calculate_unscaled_power_mW)
+    inline uint32_t estimate(uint32_t red, uint32_t green, uint32_t blue, uint32_t pixels_size)
+    {
+      return ((red * LED_CURRENT_RED_MA + green * LED_CURRENT_GREEN_MA + blue * LED_CURRENT_BLUE_MA) >> 8) + pixels_size * LED_CURRENT_IDLE_MA;
+    }
+  }
+}
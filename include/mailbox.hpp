@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+
+//lock-free single slot mailbox between one producer (e.g. a network callback) and one consumer (loop()), pure C++
+//triple buffering: the producer fills its back buffer and publishes it, the consumer takes the latest published one,
+//neither side ever waits or allocates, a frame published before the previous one was taken replaces it (counted as dropped)
+//the back buffer the producer continues in is a recycled one holding data from two publishes ago, unless publish() is told to keep
+
+namespace pixelbox
+{
+  namespace mailbox
+  {
+    static constexpr uint8_t fresh = 0x80; //flag of the shared index: published, not taken yet
+
+    template<uint32_t SIZE>
+    struct mailbox_t
+    {
+      uint8_t buffers[3][SIZE];
+      uint8_t back = 0;                   //owned by the producer
+      uint8_t front = 1;                  //owned by the consumer
+      std::atomic<uint8_t> middle{2};     //shared, index of the published buffer | fresh
+      uint32_t published = 0;             //producer side counters
+      uint32_t dropped = 0;
+
+      uint8_t* back_buffer() { return buffers[back]; }
+
+      //producer: hand over the back buffer, continue in the previously published (or taken) one
+      //keep: the new back buffer starts as a copy of the published one, for producers updating only parts of a frame
+      //(the published buffer is only read by the consumer, it can't come back to the producer before the next publish)
+      void publish(bool keep = false)
+      {
+        uint8_t handed_over = back;
+        uint8_t previous = middle.exchange(back | fresh);
+        if(previous & fresh) dropped++;
+        back = previous & ~fresh;
+        if(keep) memcpy(buffers[back], buffers[handed_over], SIZE);
+        published++;
+      }
+
+      //consumer: latest published buffer, or NULL if nothing new since the last call
+      const uint8_t* take()
+      {
+        if(!(middle.load() & fresh)) return nullptr;
+        front = middle.exchange(front) & ~fresh;
+        return buffers[front];
+      }
+    };
+  }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <ESPAsyncWebServer.h>
+
+#define MIRROR_MAX_CLIENTS     4    //browsers mirroring the display at once
+#define MIRROR_MIN_INTERVAL_MS 50   //per client, frames committed faster are skipped (latest one is sent)
+
+namespace pixelbox
+{
+  namespace mirror
+  {
+    //WebSocket on /framebuffer mirroring the LEDs, binary messages:
+    //full frame:  0x00, width (u16 LE), height (u16 LE), width * height * RGB
+    //delta frame: 0x01, (index (u16 LE), R, G, B) for every changed pixel, relative to the last frame sent to that client
+    void setup(AsyncWebServer& server);
+    void loop();
+  }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include "content_hash.hpp"
+
+#define PACK_FILE              "/pack"          //every content in one append-only file
+#define PACK_INDEX_FILE        "/pack.idx"      //index of the live contents up to a pack offset, the rest is scanned on boot
+#define PACK_INDEX_TEMP        "/pack.idx.tmp"  //written first, then renamed over the index
+#define PACK_COMPACT_FILE      "/pack.new"      //live contents copied by the compaction, renamed over the pack when complete
+#define PACK_MAGIC             0x4B505850       //"PXPK", start of every record
+#define PACK_TOMBSTONE         0xFFFFFFFF       //record size of a deleted content
+#define PACK_COPY_SIZE         512              //stack buffer for copying contents
+#define PACK_ALLOCATION_SIZE   8                //index entries allocated at once
+#define PACK_COMPACT_MIN_DEAD  16384            //compact when at least this many bytes are dead
+#define PACK_COMPACT_SLICE_US  2000             //max time spent compacting in one loop() call
+#define PACK_COMPACT_RETRY_MS  10000            //wait between compactions started (or failing for lack of space)
+
+namespace pixelbox
+{
+  namespace pack
+  {
+    //contents of the store in one append-only container, enabled with the PIXELBOX_PACKED_STORE build flag: no per image file metadata, no partially used block per image
+    //a delete appends a tombstone, the space is given back by the compaction running time sliced in loop()
+
+    typedef struct record_s    //header of a record, followed by size bytes of content (none for a tombstone)
+    {
+      uint32_t magic;
+      uint32_t size;
+      char hash[CONTENT_HASH_HEX_SIZE - 1];  //not terminated
+    } record_s;
+
+    typedef struct entry_s     //one live content
+    {
+      char hash[CONTENT_HASH_HEX_SIZE];
+      uint32_t offset;         //offset of the content (after its record header) in the pack
+      uint32_t size;
+      uint32_t new_offset;     //offset in the compacted pack, while compacting
+    } entry_s;
+
+    typedef struct stats_s
+    {
+      uint32_t file_size;      //pack file size
+      uint32_t live_bytes;     //contents and record headers still referenced
+      uint32_t dead_bytes;     //deleted contents and tombstones, given back by the next compaction
+      uint32_t contents;
+      uint32_t compactions;
+    } stats_s;
+
+    bool contains(const char* hash);
+    bool append(const String& path, const char* hash); //copy a file into the pack as a new record
+    bool remove(const char* hash);                     //append a tombstone
+
+    //open the pack positioned at the content, every opened file must be closed with close()
+    //the compaction doesn't replace the pack while a content is open
+    bool open(const char* hash, File& file, uint32_t& offset, uint32_t& size);
+    void close(File& file);
+
+    uint32_t count();
+    const entry_s* at(uint32_t index);
+    stats_s get_stats();
+
+    void setup(); //load the index, scan the records appended after it, drop a record cut by a reset
+    void loop();  //compaction
+  }
+}
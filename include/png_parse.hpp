@@ -1,3 +1,5 @@
+#pragma once
+
 #include <tinf.h>
 #include <cstring>
 #include <cinttypes>
@@ -62,6 +64,7 @@ namespace img_parse
     uint8_t* data;
     size_t size;
     uint32_t offset;
+    uint32_t allocated; //allocated size of data when streaming, size is the received part
 
     //uncompressed idata data
     uint8_t* inflated_data;
@@ -75,6 +78,17 @@ namespace img_parse
   } png_parse_context_s;
 
   bool init(png_parse_context_s& ctx, uint8_t* data, uint32_t len);
+  bool init_buffer(png_parse_context_s& ctx, uint32_t len); //allocate ctx.data only, the caller fills it (e.g. right from flash)
+  bool init_stream(png_parse_context_s& ctx, uint32_t reserve); //empty input, data arrives later through append()
   void deinit(png_parse_context_s& ctx);
   bool parse(png_parse_context_s& ctx);
+
+  //parsing in small steps, for time slicing: parse_begin() once, then parse_step() until ctx.parsed
+  bool parse_begin(png_parse_context_s& ctx); //file header and IHDR
+  bool parse_step(png_parse_context_s& ctx);  //parse the next chunk
+
+  //streaming: append() the data as it arrives, call parse_begin()/parse_step() only when the data for it is complete
+  bool append(png_parse_context_s& ctx, const uint8_t* data, uint32_t len);
+  bool begin_complete(const png_parse_context_s& ctx); //signature and IHDR received
+  bool step_complete(const png_parse_context_s& ctx);  //next chunk received entirely
 }
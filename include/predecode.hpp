@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define PREDECODE_IDLE_MS        500    //wait this long after the displayed image changed before decoding the next one
+#define PREDECODE_SLICE_US       2000   //max time spent decoding in one loop() call (one step may take longer)
+#define PREDECODE_MIN_FREE_HEAP  16384  //don't start decoding if the free heap is below this
+
+namespace pixelbox
+{
+  namespace predecode
+  {
+    //decodes the image after the displayed one in the background, time sliced in loop(), so a click displays it from the image cache
+    //afterwards images without a current estimate in the catalog are decoded for the estimate only
+
+    //called before displaying an image: finishes the background job if it's decoding that image, cancels it otherwise to free the heap
+    void finish(const String& name, uint32_t stamp);
+
+    void loop();
+  }
+}
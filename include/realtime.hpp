@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "ddp.hpp"
+
+#define REALTIME_TIMEOUT_MS 2500  //back to the stored image if no frame arrived for this long
+
+namespace pixelbox
+{
+  namespace realtime
+  {
+    typedef void (*voidcb)(void);
+
+    typedef struct stats_s
+    {
+      ddp::stats_s ddp;      //packets, frames, invalid, lost
+      uint32_t shown;        //frames displayed
+      uint32_t dropped;      //frames replaced by a newer one before loop() got to them
+      uint32_t fps;          //displayed frames in the last second
+      bool active;           //frames are being received, the stored image is not displayed
+    } stats_s;
+
+    //DDP receiver on UDP port DDP_PORT, frames are displayed right away (bypassing the stored images) until they stop coming
+    void setup(voidcb on_timeout); //on_timeout: called when the stream stopped, to display the stored image again
+    void loop();
+    stats_s get_stats();
+  }
+}
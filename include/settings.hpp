@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define SETTINGS_FILE                "/settings"
+#define SETTINGS_FLUSH_DELAY_MS      2000  //write dirty settings to flash after no change for this long
+#define SETTINGS_DEFAULT_BRIGHTNESS  50    //percent
+#define SETTINGS_DEFAULT_MAX_CURRENT 1500  //mA
+
+namespace pixelbox
+{
+  namespace settings
+  {
+    typedef struct settings_s   //every persistent setting, loaded once on boot and served from RAM
+    {
+      uint8_t brightness;       //display brightness in percent
+      uint32_t max_current;     //current limit of the display in mA
+      String displayed_image;   //filename of the displayed image
+    } settings_s;
+
+    const settings_s& get();
+
+    //setters only update RAM, the settings file is written from loop() after the debounce interval
+    void set_brightness(uint8_t percent);
+    void set_max_current(uint32_t current_ma);
+    void set_displayed_image(const String& filename);
+
+    bool flush(); //write the settings file right away if there is any change
+
+    void setup(); //load settings file (or the legacy one file per setting layout)
+    void loop();
+  }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include "catalog.hpp"
+#include "content_hash.hpp"
+#include "file_writer.hpp"
+
+#define STORE_BLOB_DIR         "/blobs"         //image contents, named by their content hash (in the pack with PIXELBOX_PACKED_STORE)
+#define STORE_MANIFEST         "/manifest"      //image name to content hash references, name=hash lines
+#define STORE_MANIFEST_TEMP    "/manifest.tmp"  //written first, then renamed over the manifest
+#define STORE_ALLOCATION_SIZE  8                //references allocated at once
+
+namespace pixelbox
+{
+  namespace store
+  {
+    //content addressed image store: every distinct content is stored once, names are references to it
+    //the content is deleted with its last reference, uploading a copy under an other name costs no flash
+
+    typedef struct ref_s      //one image name
+    {
+      char name[CATALOG_NAME_MAX];
+      char hash[CONTENT_HASH_HEX_SIZE];
+    } ref_s;
+
+    uint32_t count();
+    const ref_s* at(uint32_t index);
+    const char* hash(const String& name);  //content hash referenced by name, NULL if not found
+    uint32_t refs(const char* hash);       //number of names referencing the content
+
+    typedef struct reader_s   //read access to a stored content: a whole file, or a range of the pack
+    {
+      File file;
+      uint32_t offset;        //start of the content in the file
+      uint32_t size;
+      uint32_t position;      //relative to the start of the content
+      bool in_pack;           //a range of the pack, otherwise a blob file (with the packed store: not migrated yet)
+    } reader_s;
+
+    //every opened reader must be closed with close()
+    bool open(const String& name, reader_s& reader);
+    uint32_t read(reader_s& reader, uint8_t* buffer, uint32_t len); //bytes read, never past the end of the content
+    bool seek(reader_s& reader, uint32_t position);
+    void close(reader_s& reader);
+
+    //finish the writer and point name to its content, the written file is dropped if the content is already stored
+    //save_manifest false: a batch of new names, save() follows (a reset before it forgets them, their contents are deleted on boot)
+    bool commit(file_writer::writer_s& writer, const String& name, file_writer::stats_s& stats, bool save_manifest = true);
+    bool save(); //write the manifest
+    bool remove(const String& name); //drop the reference, the content too if it was the last one
+
+    //load the manifest, move images stored as plain files (older firmwares, filesystem uploads) into the store
+    //and delete contents left without reference by a reset
+    void setup();
+    void loop(); //background compaction of the pack
+  }
+}
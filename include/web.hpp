@@ -5,6 +5,9 @@
 
 #include "ws2812b_8x8.hpp"
 
+#define IMAGES_LIST_LINE_SIZE 192 //buffer of one formatted /images entry
+#define UPLOAD_MAX_ACTIVE     2   //concurrent uploads, each one holds a FILE_WRITER_BLOCK_SIZE buffer
+
 namespace pixelbox
 {
   namespace web
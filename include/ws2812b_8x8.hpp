@@ -3,19 +3,48 @@
 #include <FastLED.h>
 #include <arduino-timer.h>
 #include "anim.hpp"
+#include "geometry.hpp"
 #include "Hash.h"
 
-#define WS_LED_WIDTH  8
-#define WS_LED_HEIGHT 8
-#define WS_LED_NUM    (WS_LED_WIDTH * WS_LED_HEIGHT)
-#define WS_DATA_PIN   2
+//display geometry, can be overridden with build flags (e.g. -DWS_PANEL_WIDTH=16 -DWS_PANEL_HEIGHT=16)
+#ifndef WS_PANEL_WIDTH
+#define WS_PANEL_WIDTH  8   //LEDs in one row of a panel
+#endif
+#ifndef WS_PANEL_HEIGHT
+#define WS_PANEL_HEIGHT 8   //LEDs in one column of a panel
+#endif
+#ifndef WS_TILES_X
+#define WS_TILES_X      1   //chained panels horizontally
+#endif
+#ifndef WS_TILES_Y
+#define WS_TILES_Y      1   //chained panels vertically
+#endif
+#ifndef WS_WIRING
+#define WS_WIRING       0   //0: progressive, 1: serpentine
+#endif
+#ifndef WS_ROTATION
+#define WS_ROTATION     0   //clockwise rotation in degrees: 0, 90, 180, 270
+#endif
+#ifndef WS_DATA_PIN
+#define WS_DATA_PIN     2
+#endif
+
+//logical (image) size of the display
+#define WS_LED_WIDTH  (pixelbox::ws2812b_8x8::layout::width)
+#define WS_LED_HEIGHT (pixelbox::ws2812b_8x8::layout::height)
+#define WS_LED_NUM    (pixelbox::ws2812b_8x8::layout::num)
 
 namespace pixelbox
 {
   namespace ws2812b_8x8
   {
+    typedef geometry::layout_t<WS_PANEL_WIDTH, WS_PANEL_HEIGHT, WS_TILES_X, WS_TILES_Y, (geometry::wiring_e)WS_WIRING, (geometry::rotation_e)(WS_ROTATION / 90)> layout;
+
+    typedef void (*frame_cb)(const CRGB* frame); //WS_LED_NUM pixels in image (logical) order
+
     //set data to be displayed
     void set(CRGB *in); //set image 
+    void set(const CRGB* in, uint16_t width, uint16_t height, bool mapped = false); //set image with different size, centered and cropped, mapped: in is in flash (PROGMEM)
     void set(anim::animation_s* anim); //set animation
     void set_color(CRGB color); //set color
 
@@ -25,6 +54,12 @@ namespace pixelbox
     void set_max_current(uint32 current_ma);
     void set_enable(bool on);
 
+    //predicted current draw of the displayed image/animation with the actual brightness and current limit
+    void get_current_estimate(uint32_t& peak_ma, uint32_t& avg_ma);
+
+    //called on every committed frame, keep it short (it runs in the rendering path)
+    void set_frame_cb(frame_cb callback);
+
     void setup();
     void loop();
   };
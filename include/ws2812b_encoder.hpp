@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+
+//WS2812b bit encoding for a UART driven output, pure C++ (no Arduino dependency), can be built and benchmarked on a host
+
+//The UART runs at 4x the WS2812b bit rate (3.2 Mbaud) with 6N1 framing and inverted TX, so one UART frame
+//(start bit + 6 data bits + stop bit) is 8 line periods, which is exactly 2 WS2812b bits:
+//the inverted start bit is the high part of the first bit, the inverted stop bit is the low part of the second bit.
+//Every color byte becomes 4 UART symbols, a pixel 12 symbols.
+
+#define WS_ENCODER_BAUD             3200000 //4 UART bits per WS2812b bit @ 800 kHz
+#define WS_ENCODER_SYMBOLS_PER_BYTE 4
+#define WS_ENCODER_SYMBOLS_PER_LED  (3 * WS_ENCODER_SYMBOLS_PER_BYTE)
+#define WS_ENCODER_SYMBOL_US_X10    25      //one symbol (8 UART bits) is 2.5 us on the line
+#define WS_ENCODER_LATCH_US         300     //low time needed to latch the data (newer WS2812b need >280 us)
+
+namespace pixelbox
+{
+  namespace ws2812b_encoder
+  {
+    //symbol buffer size needed for led_count pixels
+    constexpr size_t encoded_size(uint32_t led_count) { return (size_t)led_count * WS_ENCODER_SYMBOLS_PER_LED; }
+
+    //line time of one frame including the latch time
+    constexpr uint32_t frame_time_us(uint32_t led_count) { return encoded_size(led_count) * WS_ENCODER_SYMBOL_US_X10 / 10 + WS_ENCODER_LATCH_US; }
+
+    //encode RGB pixel triplets (CRGB memory layout) into UART symbols in GRB order, scaling every channel with the brightness
+    //out must hold encoded_size(led_count) bytes
+    void encode(const uint8_t* rgb, uint32_t led_count, uint8_t brightness, uint8_t* out);
+
+    //encode one (already scaled) color byte into 4 symbols, MSB first
+    void encode_byte(uint8_t value, uint8_t* out);
+  }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Arduino.h>
+
+//non-blocking WS2812b output through UART1 (GPIO2 on the ESP8266), enabled with the WS_OUTPUT_UART build flag
+//the framebuffer is pre-encoded into a symbol buffer (see ws2812b_encoder.hpp), the TX FIFO is refilled from the UART interrupt,
+//so the CPU and the interrupts are free while the frame is sent (FastLED's bit-banging disables interrupts for the whole frame)
+//UART0 and UART1 share the interrupt, so Serial can't be used with RX enabled next to this backend
+
+#define WS_UART_FIFO_SIZE      128 //TX FIFO size of the ESP8266 UART
+#define WS_UART_FIFO_THRESHOLD 32  //refill the FIFO if it gets below this (32 symbols = 80 us to serve the interrupt)
+
+namespace pixelbox
+{
+  namespace ws2812b_uart
+  {
+    bool setup(uint32_t led_count);                                //allocate the symbol buffer and init UART1
+    bool show(const uint8_t* rgb, uint32_t led_count, uint8_t brightness); //encode and start sending, returns false if the previous frame is still being sent
+    bool busy();                                                   //frame is being sent or latched
+  }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+//native build shim: the part of the Arduino core the portable modules use
+
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+#include "pgmspace.h"
+
+inline uint32_t micros()
+{
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline uint32_t millis()
+{
+  return micros() / 1000;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+//native build shim: only the pixel type of FastLED, the LED output is not built natively
+
+#include <Arduino.h>
+
+struct CRGB
+{
+  union
+  {
+    struct
+    {
+      uint8_t r;
+      uint8_t g;
+      uint8_t b;
+    };
+    uint8_t raw[3];
+  };
+
+  CRGB() = default;
+  constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+
+  uint8_t& operator[](uint8_t x) { return raw[x]; }
+  const uint8_t& operator[](uint8_t x) const { return raw[x]; }
+
+  typedef enum
+  {
+    Black = 0x000000,
+    White = 0xFFFFFF,
+    Red   = 0xFF0000,
+    Green = 0x008000,
+    Blue  = 0x0000FF,
+  } HTMLColorCode;
+};
+
+inline bool operator==(const CRGB& lhs, const CRGB& rhs)
+{
+  return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b;
+}
+
+inline bool operator!=(const CRGB& lhs, const CRGB& rhs)
+{
+  return !(lhs == rhs);
+}
+
+inline void fill_solid(CRGB* leds, int num_leds, const CRGB& color)
+{
+  for(int i = 0; i < num_leds; i++) leds[i] = color;
+}
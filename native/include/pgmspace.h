@@ -0,0 +1,8 @@
+#pragma once
+
+//native build shim: flash is ordinary memory on the host
+
+#include <cstring>
+
+#define PROGMEM
+#define memcpy_P memcpy
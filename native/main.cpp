@@ -0,0 +1,158 @@
+//native build: decodes images with the firmware's parsers and plays them through the animation store, the display layout and the UART encoder
+//usage: pixelbox_native <png/gif files...>
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <cstdio>
+
+#include "anim.hpp"
+#include "geometry.hpp"
+#include "png_parse.hpp"
+#include "gif_parse.hpp"
+#include "ws2812b_encoder.hpp"
+
+//same defaults and build flags as ws2812b_8x8.hpp
+#ifndef WS_PANEL_WIDTH
+#define WS_PANEL_WIDTH  8
+#endif
+#ifndef WS_PANEL_HEIGHT
+#define WS_PANEL_HEIGHT 8
+#endif
+#ifndef WS_TILES_X
+#define WS_TILES_X      1
+#endif
+#ifndef WS_TILES_Y
+#define WS_TILES_Y      1
+#endif
+#ifndef WS_WIRING
+#define WS_WIRING       0
+#endif
+#ifndef WS_ROTATION
+#define WS_ROTATION     0
+#endif
+
+typedef pixelbox::geometry::layout_t<WS_PANEL_WIDTH, WS_PANEL_HEIGHT, WS_TILES_X, WS_TILES_Y, (pixelbox::geometry::wiring_e)WS_WIRING, (pixelbox::geometry::rotation_e)(WS_ROTATION / 90)> layout;
+
+CRGB frame[layout::num];  //framebuffer in image order
+CRGB out[layout::num];    //LED order
+uint8_t symbols[pixelbox::ws2812b_encoder::encoded_size(layout::num)]; //UART symbols of the LED data
+
+bool read_file(const char* path, uint8_t*& data, uint32_t& size)
+{
+  FILE* f = fopen(path, "rb");
+  if(f == NULL) return false;
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data = (uint8_t*)malloc(size);
+  bool ok = data != NULL && fread(data, 1, size, f) == size;
+  fclose(f);
+  if(!ok) free(data);
+  return ok;
+}
+
+//same export as the decoder, without the display size check
+bool decode(const char* path, uint8_t* data, uint32_t size, pixelbox::anim::animation_s* anim, uint16_t& width, uint16_t& height)
+{
+  const char* extension = strrchr(path, '.');
+  if(extension && strcmp(extension, ".png") == 0)
+  {
+    img_parse::png_parse_context_s ctx;
+    if(!img_parse::init(ctx, data, size)) return false;
+    bool ok = img_parse::parse(ctx);
+    if(ok)
+    {
+      width = ctx.hdr.width;
+      height = ctx.hdr.height;
+      uint32_t pixels = (uint32_t)width * height;
+      if(ctx.pixel_size == 4)
+        for(uint32_t i = 0; i < pixels; i++) memmove(ctx.unfiltered_data + 3 * i, ctx.unfiltered_data + 4 * i, 3);
+      ok = pixelbox::anim::add_frame(anim, 0, 0, 0, (CRGB*)ctx.unfiltered_data, pixels);
+    }
+    img_parse::deinit(ctx);
+    return ok;
+  }
+  if(extension && strcmp(extension, ".gif") == 0)
+  {
+    img_parse::gif_parse_context_s ctx;
+    if(img_parse::init(ctx, data, size) != img_parse::error_code_ok) return false;
+    bool ok = img_parse::parse(ctx) == img_parse::error_code_ok;
+    width = ctx.lsd.width;
+    height = ctx.lsd.height;
+    for(uint32_t i = 0; ok && i < ctx.images_size; i++)
+    {
+      img_parse::image_s& image = ctx.images[i];
+      if(ctx.images_size > 1 && !image.gce.valid) continue; //skip frames without gce
+      ok = pixelbox::anim::add_frame(anim, ctx.images_size > 1 ? image.gce.delay_time_10ms * 10 : 0, image.id.left_position, image.id.top_position, (CRGB*)image.output, image.output_size);
+    }
+    img_parse::deinit(ctx);
+    return ok && anim->frames_size > 0;
+  }
+  return false;
+}
+
+uint32_t play(pixelbox::anim::animation_s* anim, uint32_t& duration_ms)
+{
+  //every frame rendered like the display does: copied into the framebuffer, reordered to the LED wiring, encoded for the UART output
+  uint32_t checksum = 2166136261u; //FNV-1a of the UART symbols of every frame
+  duration_ms = 0;
+  for(anim->frame_index = 0; anim->frame_index < anim->frames_size; anim->frame_index++)
+  {
+    const pixelbox::anim::frame_s& current = anim->frames[anim->frame_index];
+    uint32_t pixels_to_copy = current.pixels_size > layout::num ? layout::num : current.pixels_size;
+    memcpy(frame, current.pixels, pixels_to_copy * 3);
+    for(uint32_t i = 0; i < layout::num; i++) out[layout::map.index[i]] = frame[i];
+    pixelbox::ws2812b_encoder::encode((uint8_t*)out, layout::num, 255, symbols);
+    for(uint32_t i = 0; i < sizeof(symbols); i++) checksum = (checksum ^ symbols[i]) * 16777619u;
+    duration_ms += current.delay_ms;
+  }
+  return checksum;
+}
+
+#ifndef PIO_UNIT_TESTING //the host checks in test/ bring their own main
+int main(int argc, char** argv)
+{
+  if(argc < 2)
+  {
+    fprintf(stderr, "usage: %s <png/gif files...>\n", argv[0]);
+    return 1;
+  }
+
+  int result = 0;
+  for(int i = 1; i < argc; i++)
+  {
+    uint8_t* data;
+    uint32_t size;
+    if(!read_file(argv[i], data, size))
+    {
+      fprintf(stderr, "%s: can't read\n", argv[i]);
+      result = 1;
+      continue;
+    }
+
+    pixelbox::anim::animation_s anim;
+    memset(&anim, 0, sizeof(anim));
+    uint16_t width = 0, height = 0;
+    uint32_t start = micros();
+    bool ok = decode(argv[i], data, size, &anim, width, height);
+    uint32_t decode_us = micros() - start;
+    free(data);
+    if(!ok)
+    {
+      fprintf(stderr, "%s: can't decode\n", argv[i]);
+      pixelbox::anim::animation_init(&anim);
+      result = 1;
+      continue;
+    }
+
+    uint32_t peak_ma, avg_ma, duration_ms;
+    pixelbox::anim::estimate_current(&anim, peak_ma, avg_ma);
+    uint32_t checksum = play(&anim, duration_ms);
+    printf("%s: %ux%u%s, %u frames, %u ms, decoded in %u us, %u mA peak, %u mA average, %u us per frame on the line, checksum %08x\n", argv[i], width, height,
+           width == layout::width && height == layout::height ? "" : " (doesn't fit the display)",
+           anim.frames_size, duration_ms, decode_us, peak_ma, avg_ma, pixelbox::ws2812b_encoder::frame_time_us(layout::num), checksum);
+    pixelbox::anim::animation_init(&anim);
+  }
+  return result;
+}
+#endif
@@ -0,0 +1,153 @@
+#include "alloc.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace pixelbox
+{
+  namespace alloc
+  {
+    void* system_malloc(size_t size)
+    {
+      return ::malloc(size);
+    }
+
+    void* system_calloc(size_t count, size_t size)
+    {
+      return ::calloc(count, size);
+    }
+
+    void* system_realloc(void* ptr, size_t size)
+    {
+      return ::realloc(ptr, size);
+    }
+
+    void system_free(void* ptr)
+    {
+      ::free(ptr);
+    }
+
+#ifdef ARDUINO
+    const allocator_s system_allocator = {system_malloc, system_calloc, system_realloc, system_free, NULL}; //umm_malloc doesn't tell the size of a block
+#else
+    size_t system_size(void* ptr)
+    {
+      return malloc_usable_size(ptr);
+    }
+
+    const allocator_s system_allocator = {system_malloc, system_calloc, system_realloc, system_free, system_size};
+#endif
+
+    const allocator_s* allocator = &system_allocator;
+    stats_s stats = {0, 0, 0, 0, 0, 0};
+    stats_s last_stats = {0, 0, 0, 0, 0, 0};
+    uint32_t measurement_id = 0;
+    bool measuring = false;
+    uint32_t heap_base = 0;   //free heap when the measurement started
+
+    void set_allocator(const allocator_s* new_allocator)
+    {
+      allocator = new_allocator ? new_allocator : &system_allocator;
+    }
+
+    void requested(size_t size)
+    {
+      stats.calls++;
+      stats.bytes += size;
+      if(size > stats.largest) stats.largest = size;
+    }
+
+    void released(void* ptr)
+    {
+      //blocks allocated before the measurement started may be freed as well
+      if(ptr == NULL || allocator->size == NULL) return;
+      uint32_t size = allocator->size(ptr);
+      stats.live = stats.live > size ? stats.live - size : 0;
+    }
+
+    void allocated(void* ptr)
+    {
+      if(ptr == NULL) return;
+      if(allocator->size) stats.live += allocator->size(ptr);
+#ifdef ARDUINO
+      else
+      {
+        //the heap's usage since the measurement started, everything allocated meanwhile is included
+        uint32_t free_heap = ESP.getFreeHeap();
+        stats.live = heap_base > free_heap ? heap_base - free_heap : 0;
+      }
+#endif
+      if(stats.live > stats.peak) stats.peak = stats.live;
+    }
+
+    void* malloc(size_t size)
+    {
+      requested(size);
+      void* ptr = allocator->malloc(size);
+      allocated(ptr);
+      return ptr;
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+      requested(count * size);
+      void* ptr = allocator->calloc(count, size);
+      allocated(ptr);
+      return ptr;
+    }
+
+    void* realloc(void* ptr, size_t size)
+    {
+      requested(size);
+      uint32_t live = stats.live;
+      released(ptr);
+      void* new_ptr = allocator->realloc(ptr, size);
+      if(new_ptr == NULL && size > 0)
+      {
+        stats.live = live; //the old block is still there
+        return NULL;
+      }
+      allocated(new_ptr);
+      return new_ptr;
+    }
+
+    void free(void* ptr)
+    {
+      released(ptr);
+      allocator->free(ptr);
+    }
+
+    uint32_t begin()
+    {
+      memset(&stats, 0, sizeof(stats));
+#ifdef ARDUINO
+      heap_base = ESP.getFreeHeap();
+      stats.free_block = ESP.getMaxFreeBlockSize();
+#endif
+      measuring = true;
+      return ++measurement_id;
+    }
+
+    void end(uint32_t measurement)
+    {
+      if(!measuring || measurement != measurement_id) return;
+      last_stats = stats;
+      measuring = false;
+    }
+
+    stats_s current()
+    {
+      return stats;
+    }
+
+    stats_s last()
+    {
+      return last_stats;
+    }
+  }
+}
@@ -1,40 +1,48 @@
 #include "anim.hpp"
+#include "alloc.hpp"
 #include <FastLED.h>
 
 namespace pixelbox
 {
   namespace anim
   {    
-    bool add_frame(animation_s* anim, uint32_t delay_ms, uint32_t x, uint32_t y, CRGB* pixels, uint32_t pixels_size)
+    frame_s* append_frame(animation_s* anim)
     {
-      if(!anim) return false;
+      if(!anim) return NULL;
 
       //alloc memory for frame data if necessary
       if(anim->frames == NULL)
       {
-        anim->frames = (frame_s*)calloc(FRAME_ALLOCATION_SIZE, sizeof(frame_s));
-        if(anim->frames == NULL) return false;
+        anim->frames = (frame_s*)pixelbox::alloc::calloc(FRAME_ALLOCATION_SIZE, sizeof(frame_s));
+        if(anim->frames == NULL) return NULL;
         anim->frames_size = 0;
         anim->frames_allocated = FRAME_ALLOCATION_SIZE;
       }
 
       if(anim->frames_size == anim->frames_allocated)
       {
-        anim->frames = (frame_s*)realloc(anim->frames, anim->frames_allocated + FRAME_ALLOCATION_SIZE * sizeof(frame_s));
-        if(anim->frames == NULL) return false;
+        anim->frames = (frame_s*)pixelbox::alloc::realloc(anim->frames, (anim->frames_allocated + FRAME_ALLOCATION_SIZE) * sizeof(frame_s));
+        if(anim->frames == NULL) return NULL;
         memset(anim->frames + anim->frames_size, 0, FRAME_ALLOCATION_SIZE * sizeof(frame_s));
         anim->frames_allocated += FRAME_ALLOCATION_SIZE;
       }
+      return &anim->frames[anim->frames_size];
+    }
+
+    bool add_frame(animation_s* anim, uint32_t delay_ms, uint32_t x, uint32_t y, CRGB* pixels, uint32_t pixels_size)
+    {
+      frame_s* new_frame = append_frame(anim);
+      if(new_frame == NULL) return false;
 
       //copy frame data
-      frame_s* new_frame = &anim->frames[anim->frames_size];
       new_frame->delay_ms = delay_ms;
       new_frame->x = x;
       new_frame->y = y;
-      new_frame->pixels = (CRGB*) calloc(pixels_size, sizeof(CRGB));
+      new_frame->pixels = (CRGB*) pixelbox::alloc::calloc(pixels_size, sizeof(CRGB));
       if(new_frame->pixels == NULL) return false;
       memcpy(new_frame->pixels, pixels, pixels_size * sizeof(CRGB));
       new_frame->pixels_size = pixels_size;
+      new_frame->current_ma = estimate_current(pixels, pixels_size);
       
       //update frames size
       anim->frames_size++;
@@ -42,21 +50,74 @@ namespace pixelbox
       return true;
     }
 
+    bool add_mapped_frame(animation_s* anim, uint32_t delay_ms, const CRGB* pixels, uint32_t pixels_size, uint32_t current_ma)
+    {
+      frame_s* new_frame = append_frame(anim);
+      if(new_frame == NULL) return false;
+
+      //only the frame's metadata is on the heap, the estimate was computed when the frame was stored
+      new_frame->delay_ms = delay_ms;
+      new_frame->x = 0;
+      new_frame->y = 0;
+      new_frame->pixels = (CRGB*)pixels;
+      new_frame->pixels_size = pixels_size;
+      new_frame->current_ma = current_ma;
+      new_frame->mapped = true;
+      anim->frames_size++;
+      return true;
+    }
+
     bool animation_init(animation_s* anim)
     {
       if(!anim) return false;
-      if(anim->frames_size == 0) return true;
+      if(anim->frames == NULL) return true;
       
       //dealloc every frames' pixel buffer
       for(uint32_t i = 0; i < anim->frames_size; i++)
-        if(anim->frames[i].pixels != NULL) free(anim->frames[i].pixels);
+        if(anim->frames[i].pixels != NULL && !anim->frames[i].mapped) pixelbox::alloc::free(anim->frames[i].pixels);
 
       //dealloc frame array
-      free(anim->frames);
+      pixelbox::alloc::free(anim->frames);
 
       //zero the rest
       memset(anim, 0, sizeof(animation_s));
       return true;
-    }    
+    }
+
+    uint32_t estimate_current(const CRGB* pixels, uint32_t pixels_size)
+    {
+      if(!pixels) return 0;
+
+      //sum the channels first, scale only once
+      uint32_t red = 0, green = 0, blue = 0;
+      for(uint32_t i = 0; i < pixels_size; i++)
+      {
+        red += pixels[i].r;
+        green += pixels[i].g;
+        blue += pixels[i].b;
+      }
+
+      return led_current::estimate(red, green, blue, pixels_size);
+    }
+
+    void estimate_current(const animation_s* anim, uint32_t& peak_ma, uint32_t& avg_ma, uint32_t (*predict)(uint32_t current_ma))
+    {
+      peak_ma = 0;
+      avg_ma = 0;
+      if(!anim || anim->frames_size == 0) return;
+
+      uint64_t weighted_sum = 0;
+      uint64_t duration = 0;
+      for(uint32_t i = 0; i < anim->frames_size; i++)
+      {
+        const frame_s& frame = anim->frames[i];
+        uint32_t current_ma = predict ? predict(frame.current_ma) : frame.current_ma;
+        if(current_ma > peak_ma) peak_ma = current_ma;
+        uint32_t delay_ms = frame.delay_ms ? frame.delay_ms : 1; //frames without delay still count
+        weighted_sum += (uint64_t)current_ma * delay_ms;
+        duration += delay_ms;
+      }
+      avg_ma = (uint32_t)(weighted_sum / duration);
+    }
   }
 }
\ No newline at end of file
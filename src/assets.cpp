@@ -0,0 +1,124 @@
+#include "assets.hpp"
+
+#include <string.h>
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pixelbox
+{
+  namespace assets
+  {
+    extern const uint8_t region_data[]; //generated, see assets_region.cpp
+
+    region_s builtin_region = {NULL, 0, 0, -1};
+    bool builtin_mapped = false;
+
+    bool map(region_s& region, const uint8_t* base)
+    {
+      region.base = NULL;
+      region.size = 0;
+      region.count = 0;
+      if(base == NULL) return false;
+
+      //headers are copied out, mapped flash can't be read with byte or half word loads
+      header_s header;
+      memcpy_P(&header, base, sizeof(header));
+      if(header.magic != ASSETS_MAGIC || header.size < sizeof(header) + header.count * sizeof(asset_s)) return false;
+      region.base = base;
+      region.size = header.size;
+      region.count = header.count;
+      return true;
+    }
+
+#ifndef ARDUINO
+    bool map_file(region_s& region, const char* path)
+    {
+      region.base = NULL;
+      region.fd = open(path, O_RDONLY);
+      if(region.fd < 0) return false;
+      struct stat st;
+      void* base = MAP_FAILED;
+      if(fstat(region.fd, &st) == 0 && st.st_size >= (off_t)sizeof(header_s)) base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, region.fd, 0);
+      if(base == MAP_FAILED || !map(region, (const uint8_t*)base) || region.size > (uint32_t)st.st_size)
+      {
+        if(base != MAP_FAILED) munmap(base, st.st_size);
+        close(region.fd);
+        region.fd = -1;
+        region.base = NULL;
+        return false;
+      }
+      return true;
+    }
+
+    void unmap(region_s& region)
+    {
+      if(region.base) munmap((void*)region.base, region.size);
+      if(region.fd >= 0) close(region.fd);
+      region.base = NULL;
+      region.fd = -1;
+    }
+#endif
+
+    const region_s& builtin()
+    {
+      if(!builtin_mapped)
+      {
+        map(builtin_region, region_data);
+        builtin_mapped = true;
+      }
+      return builtin_region;
+    }
+
+    bool get(const region_s& region, uint32_t index, asset_s& asset)
+    {
+      if(region.base == NULL || index >= region.count) return false;
+      memcpy_P(&asset, region.base + sizeof(header_s) + index * sizeof(asset_s), sizeof(asset));
+      asset.name[ASSETS_NAME_MAX - 1] = '\0';
+
+      //the frames must be inside the region
+      uint64_t end = (uint64_t)asset.offset + (uint64_t)asset.frames * frame_stride(asset.width, asset.height);
+      return asset.frames > 0 && asset.offset % 4 == 0 && end <= region.size;
+    }
+
+    int32_t find(const region_s& region, const char* name)
+    {
+      asset_s asset;
+      for(uint32_t i = 0; i < region.count; i++)
+        if(get(region, i, asset) && strcmp(asset.name, name) == 0) return i;
+      return -1;
+    }
+
+    const uint8_t* frame_pixels(const region_s& region, const asset_s& asset, uint32_t frame, frame_header_s& header)
+    {
+      if(frame >= asset.frames) return NULL;
+      const uint8_t* start = region.base + asset.offset + frame * frame_stride(asset.width, asset.height);
+      memcpy_P(&header, start, sizeof(header));
+      return start + sizeof(header);
+    }
+
+    bool load(const region_s& region, uint32_t index, anim::animation_s* anim)
+    {
+      asset_s asset;
+      if(anim == NULL || !get(region, index, asset)) return false;
+
+      anim::animation_init(anim);
+      for(uint32_t i = 0; i < asset.frames; i++)
+      {
+        frame_header_s header;
+        const uint8_t* pixels = frame_pixels(region, asset, i, header);
+        if(!anim::add_mapped_frame(anim, header.delay_ms, (const CRGB*)pixels, asset.width * asset.height, header.current_ma))
+        {
+          anim::animation_init(anim);
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+}
@@ -0,0 +1,135 @@
+//generated by tools/assets/make_assets.py from the assets folder, don't edit
+#include "assets.hpp"
+
+#ifdef ARDUINO
+#include <pgmspace.h>
+#endif
+
+namespace pixelbox
+{
+  namespace assets
+  {
+    //built-in assets: connecting (8x8, 8 frames), error (8x8, 1 frames)
+    //aligned for the 32 bit loads of mapped flash
+    extern const uint8_t region_data[] PROGMEM __attribute__((aligned(4))) = {
+      0x50, 0x58, 0x41, 0x53, 0x02, 0x00, 0x00, 0x00, 0x5C, 0x07, 0x00, 0x00, 0x63, 0x6F, 0x6E, 0x6E,
+      0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+      0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x94, 0x06, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x45, 0x06, 0x00, 0x00, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1,
+      0x9E, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA,
+      0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xD3, 0xA0, 0x68, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2,
+      0xD3, 0xA2, 0xDC, 0xC7, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0xD3,
+      0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80,
+      0xCA, 0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68, 0x8A,
+      0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60,
+      0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x78, 0x00, 0x00, 0x00,
+      0x45, 0x06, 0x00, 0x00, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3,
+      0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1,
+      0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA,
+      0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2,
+      0xD3, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3,
+      0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80,
+      0xCA, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0x8A,
+      0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0xC2, 0xD3, 0x68, 0x78, 0x00, 0x00, 0x00, 0x45, 0x06, 0x00, 0x00, 0x4B, 0x80, 0xCA, 0x68,
+      0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xED, 0xE1, 0x9E, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3,
+      0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xD3, 0xA0,
+      0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA,
+      0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x8A, 0xB0,
+      0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3,
+      0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0xC2, 0xD3,
+      0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0x78, 0x00, 0x00, 0x00,
+      0x45, 0x06, 0x00, 0x00, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E,
+      0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68,
+      0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3,
+      0xA2, 0xDC, 0xC7, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xD3, 0xA0, 0x68, 0xD3, 0xA0,
+      0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA,
+      0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x8A, 0xB0, 0x60, 0x8A, 0xB0,
+      0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3,
+      0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xC2, 0xD3, 0x68, 0xC2, 0xD3,
+      0x68, 0x8A, 0xB0, 0x60, 0x78, 0x00, 0x00, 0x00, 0x45, 0x06, 0x00, 0x00, 0x68, 0xC2, 0xD3, 0xA2,
+      0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80,
+      0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68,
+      0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3,
+      0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0,
+      0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA,
+      0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0,
+      0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0x78, 0x00, 0x00, 0x00,
+      0x45, 0x06, 0x00, 0x00, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2,
+      0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80,
+      0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xD3, 0xA0, 0x68,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68,
+      0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60,
+      0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0,
+      0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68,
+      0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0,
+      0x60, 0xD3, 0xA0, 0x68, 0x78, 0x00, 0x00, 0x00, 0x45, 0x06, 0x00, 0x00, 0xED, 0xE1, 0x9E, 0xED,
+      0xE1, 0x9E, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2,
+      0xD3, 0xA2, 0xDC, 0xC7, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2,
+      0xDC, 0xC7, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80,
+      0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68,
+      0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60,
+      0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B,
+      0x80, 0xCA, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0,
+      0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68,
+      0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0x78, 0x00, 0x00, 0x00,
+      0x45, 0x06, 0x00, 0x00, 0xED, 0xE1, 0x9E, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA,
+      0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xA2, 0xDC, 0xC7, 0xED, 0xE1, 0x9E, 0xED, 0xE1, 0x9E, 0xB4,
+      0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2,
+      0xD3, 0xA2, 0xDC, 0xC7, 0xA2, 0xDC, 0xC7, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52,
+      0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0xD3,
+      0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80,
+      0xCA, 0x68, 0xC2, 0xD3, 0x68, 0xC2, 0xD3, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68,
+      0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0x8A,
+      0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52,
+      0x52, 0x4B, 0x80, 0xCA, 0x4B, 0x80, 0xCA, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60,
+      0xD3, 0xA0, 0x68, 0xD3, 0xA0, 0x68, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xB4, 0x52, 0x52, 0xC2,
+      0xD3, 0x68, 0xC2, 0xD3, 0x68, 0x8A, 0xB0, 0x60, 0x8A, 0xB0, 0x60, 0xD3, 0xA0, 0x68, 0xD3, 0xA0,
+      0x68, 0xB4, 0x52, 0x52, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
+      0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
+    };
+  }
+}
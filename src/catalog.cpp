@@ -0,0 +1,289 @@
+#include "catalog.hpp"
+
+#include "store.hpp"
+
+namespace pixelbox
+{
+  namespace catalog
+  {
+    entry_s* entries = NULL;       //entries sorted by name
+    uint32_t entries_size = 0;     //used entries
+    uint32_t entries_allocated = 0;
+    uint32_t last_found = 0;       //index of the last found entry, next/previous of the displayed image is O(1)
+    uint32_t next_stamp = 1;
+    uint32_t catalog_version = 0;
+    uint32_t estimates_changes = 0;
+
+    format_e format_of(const String& name)
+    {
+      if(name.endsWith(".png")) return format_png;
+      if(name.endsWith(".gif")) return format_gif;
+      return format_unknown;
+    }
+
+    const char* format_name(uint8_t format)
+    {
+      switch (format)
+      {
+      case format_png: return "png";
+      case format_gif: return "gif";
+      default: return "unknown";
+      }
+    }
+
+    uint32_t count()
+    {
+      return entries_size;
+    }
+
+    uint32_t version()
+    {
+      return catalog_version;
+    }
+
+    uint32_t estimates_version()
+    {
+      return estimates_changes;
+    }
+
+    const entry_s* at(uint32_t index)
+    {
+      if(index >= entries_size) return NULL;
+      return &entries[index];
+    }
+
+    //binary search, returns the index of the entry or the insert position if not found
+    uint32_t lower_bound(const char* name, bool& found)
+    {
+      uint32_t lo = 0, hi = entries_size;
+      while(lo < hi)
+      {
+        uint32_t mid = (lo + hi) / 2;
+        if(strcmp(entries[mid].name, name) < 0) lo = mid + 1;
+        else hi = mid;
+      }
+      found = lo < entries_size && strcmp(entries[lo].name, name) == 0;
+      return lo;
+    }
+
+    int32_t find(const String& name)
+    {
+      //the displayed image is looked up again and again, check the last found one first
+      if(last_found < entries_size && name == entries[last_found].name) return last_found;
+
+      bool found;
+      uint32_t index = lower_bound(name.c_str(), found);
+      if(!found) return -1;
+      last_found = index;
+      return index;
+    }
+
+    const entry_s* next(const String& name)
+    {
+      if(entries_size == 0) return NULL;
+      int32_t index = find(name);
+      if(index < 0) return &entries[0];
+      return &entries[(index + 1) % entries_size];
+    }
+
+    const entry_s* previous(const String& name)
+    {
+      if(entries_size == 0) return NULL;
+      int32_t index = find(name);
+      if(index < 0) return &entries[0];
+      return &entries[(index + entries_size - 1) % entries_size];
+    }
+
+    bool read_bytes(store::reader_s& f, uint32_t offset, uint8_t* buf, uint32_t len)
+    {
+      if(!store::seek(f, offset)) return false;
+      return store::read(f, buf, len) == len;
+    }
+
+    bool skip_gif_sub_blocks(store::reader_s& f, uint32_t& offset)
+    {
+      //walk the data sub-blocks without reading their content
+      uint8_t block_size;
+      do
+      {
+        if(!read_bytes(f, offset, &block_size, 1)) return false;
+        offset += 1 + block_size;
+      } while(block_size != 0);
+      return true;
+    }
+
+    bool probe_gif(store::reader_s& f, entry_s& entry)
+    {
+      //header, logical screen descriptor
+      uint8_t hdr[13];
+      if(!read_bytes(f, 0, hdr, sizeof(hdr))) return false;
+      if(memcmp(hdr, "GIF", 3) != 0) return false;
+      entry.width = hdr[6] | (hdr[7] << 8);
+      entry.height = hdr[8] | (hdr[9] << 8);
+      uint32_t offset = sizeof(hdr);
+      if(hdr[10] & 0x80) offset += (0x01 << ((hdr[10] & 0x07) + 1)) * 3; //global color table
+
+      //count the image descriptors, skipping every data block
+      entry.frames = 0;
+      while(offset < entry.size)
+      {
+        uint8_t block[10];
+        if(!read_bytes(f, offset, block, 1)) return false;
+        if(block[0] == 0x3B) break; //trailer
+        if(block[0] == 0x2C) //image descriptor
+        {
+          if(!read_bytes(f, offset, block, sizeof(block))) return false;
+          offset += sizeof(block);
+          if(block[9] & 0x80) offset += (0x01 << ((block[9] & 0x07) + 1)) * 3; //local color table
+          offset += 1; //lzw minimum code size
+          if(!skip_gif_sub_blocks(f, offset)) return false;
+          entry.frames++;
+        }
+        else if(block[0] == 0x21) //extension
+        {
+          offset += 2;
+          if(!skip_gif_sub_blocks(f, offset)) return false;
+        }
+        else return false;
+      }
+      return true;
+    }
+
+    bool probe_png(store::reader_s& f, entry_s& entry)
+    {
+      //signature, then IHDR must be the first chunk: len, type, width, height
+      uint8_t hdr[24];
+      if(!read_bytes(f, 0, hdr, sizeof(hdr))) return false;
+      if(memcmp(hdr + 1, "PNG", 3) != 0 || memcmp(hdr + 12, "IHDR", 4) != 0) return false;
+      entry.width = (hdr[18] << 8) | hdr[19]; //only the lower 16 bits, bigger images are not displayable anyway
+      entry.height = (hdr[22] << 8) | hdr[23];
+      entry.frames = 1;
+      return true;
+    }
+
+    bool probe(const String& name, entry_s& entry)
+    {
+      memset(&entry, 0, sizeof(entry));
+      if(name.length() >= CATALOG_NAME_MAX) return false;
+      strcpy(entry.name, name.c_str());
+      entry.format = format_of(name);
+      entry.stamp = next_stamp++;
+
+      //the store knows the content hash of every image, nothing to compute
+      const char* content = store::hash(name);
+      if(content == NULL) return false;
+      strcpy(entry.hash, content);
+
+      store::reader_s f;
+      if(!store::open(name, f)) return false;
+      entry.size = f.size;
+
+      //header info is best effort, a broken file is still listed (and displayed red)
+      if(entry.format == format_png) probe_png(f, entry);
+      else if(entry.format == format_gif) probe_gif(f, entry);
+      store::close(f);
+      return true;
+    }
+
+    bool insert(const entry_s& entry)
+    {
+      bool found;
+      uint32_t index = lower_bound(entry.name, found);
+      if(found)
+      {
+        entries[index] = entry;
+        return true;
+      }
+
+      //grow the array if necessary
+      if(entries_size == entries_allocated)
+      {
+        entry_s* new_entries = (entry_s*)realloc(entries, (entries_allocated + CATALOG_ALLOCATION_SIZE) * sizeof(entry_s));
+        if(new_entries == NULL) return false;
+        entries = new_entries;
+        entries_allocated += CATALOG_ALLOCATION_SIZE;
+      }
+
+      //keep the array sorted
+      memmove(&entries[index + 1], &entries[index], (entries_size - index) * sizeof(entry_s));
+      entries[index] = entry;
+      entries_size++;
+      if(last_found >= index && last_found < entries_size - 1) last_found++;
+      return true;
+    }
+
+    bool refresh(const String& name)
+    {
+      entry_s entry;
+      if(!probe(name, entry)) return false;
+
+      //the estimate depends on the content only: kept for an unchanged content, taken over from a copy under an other name
+      for(uint32_t i = 0; i < entries_size; i++)
+      {
+        if(entries[i].peak_ma == 0 || strcmp(entries[i].hash, entry.hash) != 0) continue;
+        entry.peak_ma = entries[i].peak_ma;
+        entry.avg_ma = entries[i].avg_ma;
+        break;
+      }
+      return insert(entry);
+    }
+
+    bool update(const String& name)
+    {
+      catalog_version++;
+      return refresh(name);
+    }
+
+    uint32_t update_all(const String& names)
+    {
+      catalog_version++;
+      uint32_t updated = 0;
+      for(int start = 0; start < (int)names.length();)
+      {
+        int end = names.indexOf('\n', start);
+        if(end < 0) end = names.length();
+        if(refresh(names.substring(start, end))) updated++;
+        start = end + 1;
+      }
+      return updated;
+    }
+
+    bool remove(const String& name)
+    {
+      bool found;
+      uint32_t index = lower_bound(name.c_str(), found);
+      if(!found) return false;
+
+      memmove(&entries[index], &entries[index + 1], (entries_size - index - 1) * sizeof(entry_s));
+      entries_size--;
+      catalog_version++;
+      if(last_found > index) last_found--;
+      return true;
+    }
+
+    void set_current_estimate(const String& name, uint32_t peak_ma, uint32_t avg_ma)
+    {
+      int32_t index = find(name);
+      if(index < 0) return;
+      if(peak_ma > 0xFFFF) peak_ma = 0xFFFF;
+      if(avg_ma > 0xFFFF) avg_ma = 0xFFFF;
+      if(entries[index].peak_ma == peak_ma && entries[index].avg_ma == avg_ma) return;
+      entries[index].peak_ma = peak_ma;
+      entries[index].avg_ma = avg_ma;
+      estimates_changes++;
+    }
+
+    const char* hash(const String& name)
+    {
+      int32_t index = find(name);
+      if(index < 0) return NULL;
+      return entries[index].hash;
+    }
+
+    void setup()
+    {
+      //built from the store's references, everything else is served from the catalog
+      for(uint32_t i = 0; i < store::count(); i++) update(store::at(i)->name);
+    }
+  }
+}
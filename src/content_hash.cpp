@@ -0,0 +1,46 @@
+#include "content_hash.hpp"
+
+#include <LittleFS.h>
+
+namespace pixelbox
+{
+  namespace content_hash
+  {
+    void begin(hasher_s& hasher)
+    {
+      br_sha1_init(&hasher);
+    }
+
+    void update(hasher_s& hasher, const uint8_t* data, uint32_t len)
+    {
+      br_sha1_update(&hasher, data, len);
+    }
+
+    void finish(const hasher_s& hasher, char hex[CONTENT_HASH_HEX_SIZE])
+    {
+      uint8_t digest[br_sha1_SIZE];
+      br_sha1_out(&hasher, digest);
+      for(uint32_t i = 0; i < CONTENT_HASH_BYTES; i++) sprintf(hex + 2 * i, "%02x", digest[i]);
+      hex[CONTENT_HASH_HEX_SIZE - 1] = '\0';
+    }
+
+    bool file(const String& path, char hex[CONTENT_HASH_HEX_SIZE])
+    {
+      File f = LittleFS.open(path, "r");
+      if(!f) return false;
+
+      hasher_s hasher;
+      begin(hasher);
+      uint8_t buffer[CONTENT_HASH_READ_SIZE];
+      while(f.available() > 0)
+      {
+        int len = f.read(buffer, sizeof(buffer));
+        if(len <= 0) break;
+        update(hasher, buffer, len);
+      }
+      f.close();
+      finish(hasher, hex);
+      return true;
+    }
+  }
+}
@@ -0,0 +1,70 @@
+#include "ddp.hpp"
+
+#include <cstring>
+
+namespace pixelbox
+{
+  namespace ddp
+  {
+    bool parse(const uint8_t* packet, uint32_t len, header_s& header)
+    {
+      if(packet == nullptr || len < DDP_HEADER_SIZE) return false;
+
+      header.flags = packet[0];
+      if((header.flags & DDP_FLAG_VERSION) != DDP_FLAG_VERSION_1) return false;
+      header.sequence = packet[1] & 0x0F;
+      header.data_type = packet[2];
+      header.id = packet[3];
+      header.offset = ((uint32_t)packet[4] << 24) | ((uint32_t)packet[5] << 16) | ((uint32_t)packet[6] << 8) | packet[7];
+      header.length = (packet[8] << 8) | packet[9];
+
+      //the optional timecode is between the header and the data
+      uint32_t data_offset = DDP_HEADER_SIZE + (header.flags & DDP_FLAG_TIMECODE ? 4 : 0);
+      if(len < data_offset + header.length) return false;
+      header.data = packet + data_offset;
+      return true;
+    }
+
+    bool receive(const uint8_t* packet, uint32_t len, uint8_t* frame, uint32_t frame_size, stats_s& stats)
+    {
+      stats.packets++;
+
+      header_s header;
+      if(!parse(packet, len, header) || header.id != DDP_ID_DISPLAY || (header.flags & DDP_FLAG_QUERY))
+      {
+        stats.invalid++;
+        return false;
+      }
+
+      //data type: 0 (undefined) or RGB with 8 bit channels (type 1, size 0 or 3)
+      uint8_t type = (header.data_type >> 3) & 0x07;
+      uint8_t size = header.data_type & 0x07;
+      if(type > 1 || (size != 0 && size != 3))
+      {
+        stats.invalid++;
+        return false;
+      }
+
+      //sequence numbers wrap from 15 to 1, 0 means the sender doesn't use them
+      if(header.sequence != 0 && stats.last_sequence != 0)
+      {
+        uint8_t expected = stats.last_sequence == 15 ? 1 : stats.last_sequence + 1;
+        if(header.sequence != expected) stats.lost += (header.sequence + 15 - expected) % 15;
+      }
+      stats.last_sequence = header.sequence;
+
+      //whatever falls outside the display is dropped
+      if(header.offset < frame_size)
+      {
+        uint32_t copy = header.length;
+        if(copy > frame_size - header.offset) copy = frame_size - header.offset;
+        memcpy(frame + header.offset, header.data, copy);
+      }
+
+      //a frame is complete on push, senders not using push fill the whole frame with every packet
+      bool complete = (header.flags & DDP_FLAG_PUSH) || header.offset + header.length == frame_size;
+      if(complete) stats.frames++;
+      return complete;
+    }
+  }
+}
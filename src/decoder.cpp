@@ -0,0 +1,336 @@
+#include "decoder.hpp"
+
+#include "ws2812b_8x8.hpp"
+#include "alloc.hpp"
+
+namespace pixelbox
+{
+  namespace decoder
+  {
+    bool export_png(img_parse::png_parse_context_s& ctx, anim::animation_s* anim)
+    {
+      //check for image with invalid size
+      if(ctx.hdr.height != WS_LED_HEIGHT || ctx.hdr.width != WS_LED_WIDTH) return false;
+
+      //export output pixel data from the context into a CRGB array, dropping the alpha channel if necessary
+      if(ctx.pixel_size == 4)
+      {
+        for(uint32_t i = 0; i < WS_LED_NUM; i++)
+        {
+          ctx.unfiltered_data[3*i+0] = ctx.unfiltered_data[4*i+0];
+          ctx.unfiltered_data[3*i+1] = ctx.unfiltered_data[4*i+1];
+          ctx.unfiltered_data[3*i+2] = ctx.unfiltered_data[4*i+2];
+        }
+      }
+      return anim::add_frame(anim, 0, 0, 0, (CRGB*)ctx.unfiltered_data, WS_LED_NUM);
+    }
+
+    bool export_gif(img_parse::gif_parse_context_s& ctx, anim::animation_s* anim)
+    {
+      //check for image with invalid size
+      if(ctx.lsd.height != WS_LED_HEIGHT || ctx.lsd.width != WS_LED_WIDTH) return false;
+
+      if(ctx.images_size == 1) //if it's an image, it's a single frame
+        return anim::add_frame(anim, 0, 0, 0, (CRGB*)ctx.images[0].output, ctx.images[0].output_size);
+
+      //if it's an animation export the frames into the animation
+      for(uint32_t i = 0; i < ctx.images_size; i++)
+      {
+        if(!ctx.images[i].gce.valid) continue; //skip frames without gce
+        if(!anim::add_frame(anim,
+                            ctx.images[i].gce.delay_time_10ms * 10,
+                            ctx.images[i].id.left_position,
+                            ctx.images[i].id.top_position,
+                            (CRGB*)ctx.images[i].output,
+                            ctx.images[i].output_size)) return false;
+      }
+      return anim->frames_size > 0;
+    }
+
+    bool decode_png(uint8_t* data, uint32_t size, anim::animation_s* anim, bool release_data)
+    {
+      //init the PNG parsing context
+      img_parse::png_parse_context_s ctx;
+      bool init_ok = img_parse::init(ctx, data, size);
+      if(release_data) free(data); //after init, image data copied into the ctx
+      if(!init_ok) return false;
+
+      bool ok = img_parse::parse(ctx) && export_png(ctx, anim);
+
+      //dealloc everything left from the parsing
+      img_parse::deinit(ctx);
+      return ok;
+    }
+
+    bool decode_gif(uint8_t* data, uint32_t size, anim::animation_s* anim, bool release_data)
+    {
+      //init the GIF parsing context
+      img_parse::gif_parse_context_s ctx;
+      bool init_ok = img_parse::init(ctx, data, size) == img_parse::error_code_ok;
+      if(release_data) free(data); //after init, image data copied into the ctx
+      if(!init_ok) return false;
+
+      bool ok = img_parse::parse(ctx) == img_parse::error_code_ok && export_gif(ctx, anim);
+
+      //dealloc everything left from the parsing
+      img_parse::deinit(ctx);
+      return ok;
+    }
+
+    bool decode(uint8_t* data, uint32_t size, catalog::format_e format, anim::animation_s* anim, bool release_data)
+    {
+      if(data == NULL || anim == NULL)
+      {
+        if(release_data && data) free(data);
+        return false;
+      }
+
+      //the heap used by the parser and the frames is measured, available as the last stats
+      uint32_t measurement = alloc::begin();
+      bool ok = false;
+      if(format == catalog::format_png) ok = decode_png(data, size, anim, release_data);
+      else if(format == catalog::format_gif) ok = decode_gif(data, size, anim, release_data);
+      else if(release_data) free(data);
+
+      if(!ok) anim::animation_init(anim); //don't leave half decoded animations behind
+      alloc::end(measurement);
+      return ok;
+    }
+
+    bool decode_file(const String& name, anim::animation_s* anim)
+    {
+      //currently only supports PNG and GIF, check the file extension
+      catalog::format_e format = catalog::format_of(name);
+      if(format == catalog::format_unknown) return false;
+
+      store::reader_s image_file;
+      if(!store::open(name, image_file)) return false;
+
+      //read image file into RAM
+      uint32_t img_size = image_file.size;
+      uint8_t* img_buf = (uint8_t*) malloc(img_size);
+      if(img_buf == NULL)
+      {
+        store::close(image_file);
+        return false;
+      }
+      if(store::read(image_file, (uint8_t*)img_buf, img_size) != img_size)
+      {
+        free(img_buf);
+        store::close(image_file);
+        return false;
+      }
+      store::close(image_file); //we don't need the file to be open any more, close it
+
+      return decode(img_buf, img_size, format, anim, true);
+    }
+
+    bool job_start(job_s& job, const String& name, uint32_t stamp)
+    {
+      job_cancel(job);
+
+      job.format = catalog::format_of(name);
+      if(job.format == catalog::format_unknown) return false;
+      if(!store::open(name, job.file)) return false;
+
+      //the parser's input buffer is filled right from flash, no extra copy
+      job.size = job.file.size;
+      job.measurement = alloc::begin();
+      bool ok = job.format == catalog::format_png ? img_parse::init_buffer(job.png, job.size) : img_parse::init_buffer(job.gif, job.size) == img_parse::error_code_ok;
+      if(!ok)
+      {
+        store::close(job.file);
+        return false;
+      }
+
+      job.name = name;
+      job.stamp = stamp;
+      job.read = 0;
+      job.state = job_state_reading;
+      return true;
+    }
+
+    void job_fail(job_s& job)
+    {
+      alloc::end(job.measurement);
+      job_cancel(job);
+      job.state = job_state_failed;
+    }
+
+    bool job_step(job_s& job)
+    {
+      switch (job.state)
+      {
+      case job_state_reading:
+      {
+        //read one slice of the file
+        uint8_t* input = job.format == catalog::format_png ? job.png.data : job.gif.input;
+        uint32_t len = job.size - job.read > DECODER_READ_SLICE ? DECODER_READ_SLICE : job.size - job.read;
+        if(store::read(job.file, input + job.read, len) != len)
+        {
+          job_fail(job);
+          return false;
+        }
+        job.read += len;
+        if(job.read < job.size) return true;
+
+        store::close(job.file);
+        bool ok = job.format == catalog::format_png ? img_parse::parse_begin(job.png) : img_parse::parse_begin(job.gif) == img_parse::error_code_ok;
+        if(!ok)
+        {
+          job_fail(job);
+          return false;
+        }
+        job.state = job_state_parsing;
+        return true;
+      }
+      case job_state_parsing:
+      {
+        //parse one chunk/block
+        bool ok = job.format == catalog::format_png ? img_parse::parse_step(job.png) : img_parse::parse_step(job.gif) == img_parse::error_code_ok;
+        if(!ok)
+        {
+          job_fail(job);
+          return false;
+        }
+
+        bool parsed = job.format == catalog::format_png ? job.png.parsed : job.gif.parsed;
+        if(!parsed) return true;
+
+        //export the frames and free the parser
+        ok = job.format == catalog::format_png ? export_png(job.png, &job.anim) : export_gif(job.gif, &job.anim);
+        if(job.format == catalog::format_png) img_parse::deinit(job.png);
+        else img_parse::deinit(job.gif);
+        if(!ok)
+        {
+          job_fail(job);
+          return false;
+        }
+        alloc::end(job.measurement);
+        job.state = job_state_done;
+        return false;
+      }
+      default:
+        return false;
+      }
+    }
+
+    void job_cancel(job_s& job)
+    {
+      store::close(job.file);
+      if(job.format == catalog::format_png) img_parse::deinit(job.png);
+      else if(job.format == catalog::format_gif) img_parse::deinit(job.gif);
+      anim::animation_init(&job.anim);
+      job.format = catalog::format_unknown;
+      job.state = job_state_idle;
+      job.read = 0;
+      job.size = 0;
+    }
+
+    bool stream_begin(stream_s& stream, catalog::format_e format, uint32_t expected_size, bool header_only)
+    {
+      stream_cancel(stream);
+      if(format == catalog::format_unknown) return false;
+
+      //the whole input is kept in RAM until the image is parsed, big ones are decoded from flash later
+      //a header check keeps only the start of the input, the buffer grows until the header is complete
+      if(header_only) expected_size = 0;
+      else if(expected_size > DECODER_STREAM_MAX_SIZE) return false;
+      if(ESP.getFreeHeap() < expected_size + DECODER_STREAM_MIN_FREE_HEAP) return false;
+
+      stream.measurement = alloc::begin();
+      bool ok = format == catalog::format_png ? img_parse::init_stream(stream.png, expected_size) : img_parse::init_stream(stream.gif, expected_size) == img_parse::error_code_ok;
+      if(!ok) return false;
+      stream.format = format;
+      stream.active = true;
+      stream.header_only = header_only;
+      return true;
+    }
+
+    bool stream_feed(stream_s& stream, const uint8_t* data, uint32_t len)
+    {
+      if(!stream.active || stream.done) return true;
+      bool png = stream.format == catalog::format_png;
+
+      bool ok = png ? img_parse::append(stream.png, data, len) : img_parse::append(stream.gif, data, len) == img_parse::error_code_ok;
+      if(!ok)
+      {
+        //out of memory is not the image's fault, it will be decoded from flash
+        stream_cancel(stream);
+        return true;
+      }
+
+      if(!stream.begun)
+      {
+        if(!(png ? img_parse::begin_complete(stream.png) : img_parse::begin_complete(stream.gif))) return true;
+
+        //check the header and the size right away, an image not fitting the display is rejected before receiving the rest
+        ok = png ? img_parse::parse_begin(stream.png) : img_parse::parse_begin(stream.gif) == img_parse::error_code_ok;
+        if(ok && png) ok = stream.png.hdr.width == WS_LED_WIDTH && stream.png.hdr.height == WS_LED_HEIGHT;
+        if(ok && !png) ok = stream.gif.lsd.width == WS_LED_WIDTH && stream.gif.lsd.height == WS_LED_HEIGHT;
+        if(!ok)
+        {
+          alloc::end(stream.measurement);
+          stream_cancel(stream);
+          return false;
+        }
+        stream.begun = true;
+        if(stream.header_only)
+        {
+          //checked, the rest is only stored
+          alloc::end(stream.measurement);
+          stream_cancel(stream);
+          return true;
+        }
+      }
+
+      //parse every chunk/block received entirely
+      while(png ? img_parse::step_complete(stream.png) : img_parse::step_complete(stream.gif))
+      {
+        ok = png ? img_parse::parse_step(stream.png) : img_parse::parse_step(stream.gif) == img_parse::error_code_ok;
+        if(!ok)
+        {
+          alloc::end(stream.measurement);
+          stream_cancel(stream);
+          return false;
+        }
+      }
+
+      if(!(png ? stream.png.parsed : stream.gif.parsed)) return true;
+
+      //export the frames and free the parser
+      ok = png ? export_png(stream.png, &stream.anim) : export_gif(stream.gif, &stream.anim);
+      if(png) img_parse::deinit(stream.png);
+      else img_parse::deinit(stream.gif);
+      alloc::end(stream.measurement);
+      if(!ok)
+      {
+        stream_cancel(stream);
+        return false;
+      }
+      stream.done = true;
+      return true;
+    }
+
+    void stream_cancel(stream_s& stream)
+    {
+      if(stream.format == catalog::format_png) img_parse::deinit(stream.png);
+      else if(stream.format == catalog::format_gif) img_parse::deinit(stream.gif);
+      anim::animation_init(&stream.anim);
+      stream.format = catalog::format_unknown;
+      stream.active = false;
+      stream.begun = false;
+      stream.done = false;
+      stream.header_only = false;
+    }
+
+    uint32_t animation_bytes(const anim::animation_s* anim)
+    {
+      if(!anim) return 0;
+      uint32_t bytes = anim->frames_allocated * sizeof(anim::frame_s);
+      for(uint32_t i = 0; i < anim->frames_size; i++)
+        if(!anim->frames[i].mapped) bytes += anim->frames[i].pixels_size * sizeof(CRGB);
+      return bytes;
+    }
+  }
+}
@@ -0,0 +1,86 @@
+#include "events.hpp"
+
+#include "settings.hpp"
+#include "catalog.hpp"
+#include "fs_usage.hpp"
+
+namespace pixelbox
+{
+  namespace events
+  {
+    AsyncEventSource source("/events");
+    uint32_t last_check_ms = 0;
+    bool send_all = false;            //a client connected, it needs the whole state
+
+    //last pushed state
+    String sent_displayed;
+    String sent_displayed_hash;       //a re-upload under the displayed name changes the content, not the name
+    uint32_t sent_catalog_version = 0;
+    uint32_t sent_estimates_version = 0;
+    uint8_t sent_brightness = 0;
+    uint32_t sent_max_current = 0;
+    uint32_t sent_used = 0;
+
+    void send(const char* event, const String& data)
+    {
+      source.send(data.c_str(), event, millis());
+    }
+
+    void send_storage()
+    {
+      sent_used = fs_usage::used();
+      send("storage", "{\"total_size\":" + String(fs_usage::total() / 1024) + ", \"allocated_size\":" + String(sent_used / 1024) + ", \"free_heap\":" + String(ESP.getFreeHeap()) + "}");
+    }
+
+    void setup(AsyncWebServer& server)
+    {
+      source.onConnect([](AsyncEventSourceClient* client)
+      {
+        client->send("connected", NULL, millis(), EVENTS_RECONNECT_MS); //sets the browser's reconnect delay
+        send_all = true; //the state is sent from loop(), not from the network callback
+      });
+      server.addHandler(&source);
+    }
+
+    void loop()
+    {
+      if(millis() - last_check_ms < EVENTS_INTERVAL_MS) return;
+      last_check_ms = millis();
+      if(source.count() == 0) return; //nothing to do while no page is open
+
+      const settings::settings_s& current = settings::get();
+      const char* displayed_hash = catalog::hash(current.displayed_image);
+      if(displayed_hash == NULL) displayed_hash = "";
+      if(send_all || sent_displayed != current.displayed_image || sent_displayed_hash != displayed_hash)
+      {
+        sent_displayed = current.displayed_image;
+        sent_displayed_hash = displayed_hash;
+        send("displayed", "{\"name\":\"" + sent_displayed + "\"}");
+      }
+      if(send_all || sent_brightness != current.brightness || sent_max_current != current.max_current)
+      {
+        sent_brightness = current.brightness;
+        sent_max_current = current.max_current;
+        send("settings", "{\"brightness\":" + String(sent_brightness) + ", \"max_current\":" + String(sent_max_current) + "}");
+      }
+      if(send_all || sent_catalog_version != catalog::version())
+      {
+        //stored files changed, so did the storage usage
+        sent_catalog_version = catalog::version();
+        sent_estimates_version = catalog::estimates_version();
+        send("catalog", "{\"count\":" + String(catalog::count()) + "}");
+        send_storage();
+      }
+      else
+      {
+        if(sent_estimates_version != catalog::estimates_version()) //the list shows the current estimates
+        {
+          sent_estimates_version = catalog::estimates_version();
+          send("catalog", "{\"count\":" + String(catalog::count()) + "}");
+        }
+        if(sent_used != fs_usage::used()) send_storage(); //e.g. the pack compacted, the settings written
+      }
+      send_all = false;
+    }
+  }
+}
@@ -0,0 +1,178 @@
+#include "file_writer.hpp"
+
+#include "fs_usage.hpp"
+
+namespace pixelbox
+{
+  namespace file_writer
+  {
+    uint32_t temp_counter = 0;
+
+    bool flash_write(writer_s& writer, const uint8_t* data, uint32_t len)
+    {
+      uint32_t start = micros();
+      uint32_t written = writer.file.write(data, len);
+      writer.flash_us += micros() - start;
+      if(written != len) writer.failed = true;
+      fs_usage::resized(writer.flushed, writer.flushed + written); //a short write (flash full) still takes what it wrote
+      writer.flushed += written;
+      return written == len;
+    }
+
+    void drop_temp(writer_s& writer)
+    {
+      if(writer.file) writer.file.close();
+      if(writer.temp_path.length() > 0 && LittleFS.remove(writer.temp_path)) fs_usage::resized(writer.flushed, 0);
+      writer.flushed = 0;
+      writer.temp_path = String();
+      writer.buffered = 0;
+    }
+
+    bool begin(writer_s& writer, const String& path, uint32_t expected_size)
+    {
+      drop_temp(writer);
+
+      //the old file stays until the rename, so the new one needs its full size (and a block for metadata) on top
+      if(expected_size > 0 && fs_usage::free_space() < expected_size + FILE_WRITER_BLOCK_SIZE) return false;
+
+      //the buffer is kept after a commit, writing several files in a row allocates it only once
+      if(writer.buffer == NULL) writer.buffer = (uint8_t*)malloc(FILE_WRITER_BLOCK_SIZE);
+      if(writer.buffer == NULL) return false;
+
+      writer.path = path;
+      writer.temp_path = String(FILE_WRITER_TEMP_DIR) + "/" + String(temp_counter++);
+      writer.file = LittleFS.open(writer.temp_path, "w");
+      if(!writer.file)
+      {
+        abort(writer);
+        return false;
+      }
+      writer.buffered = 0;
+      writer.flushed = 0;
+      writer.size = 0;
+      writer.flash_us = 0;
+      writer.start_ms = millis();
+      writer.failed = false;
+      content_hash::begin(writer.hasher);
+      return true;
+    }
+
+    bool write(writer_s& writer, const uint8_t* data, uint32_t len)
+    {
+      if(!active(writer) || writer.failed) return false;
+      writer.size += len;
+      content_hash::update(writer.hasher, data, len);
+
+      while(len > 0)
+      {
+        //whole blocks go straight to the flash if nothing is buffered
+        if(writer.buffered == 0 && len >= FILE_WRITER_BLOCK_SIZE)
+        {
+          uint32_t blocks_len = len - len % FILE_WRITER_BLOCK_SIZE;
+          if(!flash_write(writer, data, blocks_len)) return false;
+          data += blocks_len;
+          len -= blocks_len;
+          continue;
+        }
+
+        //fill the buffer, write it out when a block is complete
+        uint32_t copy = FILE_WRITER_BLOCK_SIZE - writer.buffered;
+        if(copy > len) copy = len;
+        memcpy(writer.buffer + writer.buffered, data, copy);
+        writer.buffered += copy;
+        data += copy;
+        len -= copy;
+        if(writer.buffered == FILE_WRITER_BLOCK_SIZE)
+        {
+          if(!flash_write(writer, writer.buffer, FILE_WRITER_BLOCK_SIZE)) return false;
+          writer.buffered = 0;
+        }
+      }
+      return true;
+    }
+
+    bool finish(writer_s& writer, stats_s* stats)
+    {
+      if(!active(writer) || writer.failed || !writer.file)
+      {
+        abort(writer);
+        return false;
+      }
+
+      //write the last partial block
+      if(writer.buffered > 0 && !flash_write(writer, writer.buffer, writer.buffered))
+      {
+        abort(writer);
+        return false;
+      }
+      writer.buffered = 0;
+      writer.file.close();
+
+      if(stats)
+      {
+        stats->size = writer.size;
+        stats->total_ms = millis() - writer.start_ms;
+        stats->flash_ms = writer.flash_us / 1000;
+        content_hash::finish(writer.hasher, stats->hash);
+      }
+      return true;
+    }
+
+    bool commit(writer_s& writer, stats_s* stats)
+    {
+      //finish() may have been called already, e.g. to decide the final path based on the content hash
+      if(writer.file && !finish(writer, stats)) return false;
+      if(!active(writer))
+      {
+        abort(writer);
+        return false;
+      }
+
+      //LittleFS renames atomically, replacing the old file: readers see either the old or the complete new one
+      File old_file = LittleFS.exists(writer.path) ? LittleFS.open(writer.path, "r") : File();
+      uint32_t old_size = old_file ? old_file.size() : 0;
+      if(old_file) old_file.close();
+      int separator = writer.path.lastIndexOf('/');
+      if(separator > 0) LittleFS.mkdir(writer.path.substring(0, separator)); //LittleFS drops empty directories, rename doesn't create them
+      if(!LittleFS.rename(writer.temp_path, writer.path))
+      {
+        abort(writer);
+        return false;
+      }
+      fs_usage::resized(old_size, 0);
+      writer.flushed = 0;
+      writer.temp_path = String();
+      return true;
+    }
+
+    void discard(writer_s& writer)
+    {
+      drop_temp(writer);
+    }
+
+    void abort(writer_s& writer)
+    {
+      drop_temp(writer);
+      if(writer.buffer) free(writer.buffer);
+      writer.buffer = NULL;
+    }
+
+    bool active(const writer_s& writer)
+    {
+      return writer.temp_path.length() > 0;
+    }
+
+    void setup()
+    {
+      //don't remove while iterating the directory, start over after each removal
+      bool removed = true;
+      while(removed)
+      {
+        removed = false;
+        Dir dir = LittleFS.openDir(FILE_WRITER_TEMP_DIR);
+        while(dir.next() && !removed)
+          if(dir.isFile()) removed = LittleFS.remove(String(FILE_WRITER_TEMP_DIR) + "/" + dir.fileName());
+      }
+    }
+  }
+}
@@ -0,0 +1,55 @@
+#include "fs_usage.hpp"
+
+#include <LittleFS.h>
+
+namespace pixelbox
+{
+  namespace fs_usage
+  {
+    uint32_t total_bytes = 0;
+    uint32_t used_bytes = 0;
+    uint32_t block_bytes = 4096;
+
+    void setup()
+    {
+      fs::FSInfo info;
+      if(!LittleFS.info(info)) return;
+      total_bytes = info.totalBytes;
+      used_bytes = info.usedBytes;
+      block_bytes = info.blockSize;
+    }
+
+    uint32_t total()
+    {
+      return total_bytes;
+    }
+
+    uint32_t used()
+    {
+      return used_bytes;
+    }
+
+    uint32_t free_space()
+    {
+      return total_bytes > used_bytes ? total_bytes - used_bytes : 0;
+    }
+
+    uint32_t block_size()
+    {
+      return block_bytes;
+    }
+
+    uint32_t blocks(uint32_t size)
+    {
+      return (size + block_bytes - 1) / block_bytes;
+    }
+
+    void resized(uint32_t old_size, uint32_t new_size)
+    {
+      uint32_t old_bytes = blocks(old_size) * block_bytes;
+      uint32_t new_bytes = blocks(new_size) * block_bytes;
+      if(new_bytes >= old_bytes) used_bytes += new_bytes - old_bytes;
+      else used_bytes -= old_bytes - new_bytes > used_bytes ? used_bytes : old_bytes - new_bytes;
+    }
+  }
+}
@@ -1,4 +1,5 @@
 #include "gif_parse.hpp"
+#include "alloc.hpp"
 
 #include <cstring>
 #include <cinttypes>
@@ -18,7 +19,7 @@ namespace img_parse
     if(ctx.input_size < (6 + 7 + gct_size)) return error_code_inconsistence;
 
     //allocate memory for gct and copy it
-    ctx.gct = (color_s*)calloc(gct_size, 1);
+    ctx.gct = (color_s*)pixelbox::alloc::calloc(gct_size, 1);
     if(ctx.gct == NULL) return error_code_null_pt;
     ctx.gct_size = gct_size / 3;
     memcpy(ctx.gct, ctx.input + ctx.offset, gct_size);
@@ -75,7 +76,7 @@ namespace img_parse
     uint32_t alloc_size = string_size;
     if(alloc_size < 4) alloc_size = 4;
 
-    image->code_table.entries[code].string = (uint8_t*)calloc(0x01, alloc_size);
+    image->code_table.entries[code].string = (uint8_t*)pixelbox::alloc::calloc(0x01, alloc_size);
     if(!image->code_table.entries[code].string) return error_code_mem_alloc;
     memcpy(image->code_table.entries[code].string, string_pt, string_size);
     image->code_table.entries_count++;
@@ -84,7 +85,7 @@ namespace img_parse
     if(image->code_table.entries_count == (uint32_t)(0x01 << (image->code_size + 1))) //code size bump time baby
     {
       image->code_size++;
-      image->code_table.entries = (code_table_entry_s*)realloc(image->code_table.entries, sizeof(code_table_entry_s) * (0x01 << (image->code_size + 1)));
+      image->code_table.entries = (code_table_entry_s*)pixelbox::alloc::realloc(image->code_table.entries, sizeof(code_table_entry_s) * (0x01 << (image->code_size + 1)));
       if(!image->code_table.entries) return error_code_mem_alloc;
       //zero the newly allocated space
       memset(image->code_table.entries + (0x1 << image->code_size), 0, sizeof(code_table_entry_s) * (0x1 << image->code_size));
@@ -99,7 +100,7 @@ namespace img_parse
     if(image->code_size < 2) return error_code_inconsistence; //min allowed code size
 
     //allocate mem for code table                     
-    image->code_table.entries = (code_table_entry_s*)calloc(0x01 << (image->code_size + 1), sizeof(code_table_entry_s));
+    image->code_table.entries = (code_table_entry_s*)pixelbox::alloc::calloc(0x01 << (image->code_size + 1), sizeof(code_table_entry_s));
     image->code_table.entries_count = 0;
     if(!image->code_table.entries) return error_code_mem_alloc;
 
@@ -123,7 +124,7 @@ namespace img_parse
     {
       if(image->code_table.entries[code].string)
       {
-        free(image->code_table.entries[code].string);
+        pixelbox::alloc::free(image->code_table.entries[code].string);
         image->code_table.entries[code].string = NULL;
         image->code_table.entries[code].string_size = 0;
       }
@@ -132,7 +133,7 @@ namespace img_parse
     //free the table
     if(image->code_table.entries)
     {
-      free(image->code_table.entries);
+      pixelbox::alloc::free(image->code_table.entries);
       image->code_table.entries = NULL;
       image->code_table.entries_count = 0;
       image->code_table.cc = 0;
@@ -155,7 +156,7 @@ namespace img_parse
     if(ctx.input_size < (ctx.offset + lct_size)) return error_code_out_of_bounds;
 
     //allocate memory for lct and copy it
-    image_pt->lct = (color_s*)calloc(lct_size, 1);
+    image_pt->lct = (color_s*)pixelbox::alloc::calloc(lct_size, 1);
     if(image_pt->lct == NULL) return error_code_mem_alloc;
     image_pt->lct_size = lct_size / 3;
     memcpy(image_pt->lct, ctx.input + ctx.offset, lct_size);
@@ -235,7 +236,7 @@ namespace img_parse
     //realloc if necessary
     if(image->index_stream_offset + copy_size > image->index_stream_size)
     {
-      image->index_stream = (uint8_t*)realloc(image->index_stream, image->index_stream_size + INDEX_STREAM_ALLOCATION_BLOCK);
+      image->index_stream = (uint8_t*)pixelbox::alloc::realloc(image->index_stream, image->index_stream_size + INDEX_STREAM_ALLOCATION_BLOCK);
       if(!image->index_stream) return error_code_mem_alloc;
       image->index_stream_size = image->index_stream_size + INDEX_STREAM_ALLOCATION_BLOCK;
     }
@@ -254,7 +255,7 @@ namespace img_parse
     //free local color table
     if(image->lct)
     {
-      free(image->lct);
+      pixelbox::alloc::free(image->lct);
       image->lct = NULL;
       image->lct_size = 0;
     }
@@ -262,7 +263,7 @@ namespace img_parse
     //free LZW compressed data
     if(image->lzw)
     {
-      free(image->lzw);
+      pixelbox::alloc::free(image->lzw);
       image->lzw = NULL;
       image->lzw_size = 0;
       image->lzw_offset_bit = 0;
@@ -274,7 +275,7 @@ namespace img_parse
 
     if(image->index_stream)
     {
-      free(image->index_stream);
+      pixelbox::alloc::free(image->index_stream);
       image->index_stream = NULL;
       image->index_stream_offset = 0,
       image->index_stream_size = 0;
@@ -290,7 +291,7 @@ namespace img_parse
     free_image_parsing_memory(image);
     if(image->output)
     {
-      free(image->output);
+      pixelbox::alloc::free(image->output);
       image->output = NULL;
       image->output_size = 0;
     }
@@ -307,13 +308,13 @@ namespace img_parse
     //allocate mem for the new image data
     if(ctx.images == NULL)
     {
-      ctx.images = (image_s*)calloc(1, sizeof(image_s));
+      ctx.images = (image_s*)pixelbox::alloc::calloc(1, sizeof(image_s));
       if(ctx.images == NULL) return error_code_mem_alloc;
       ctx.images_size = 1;
     }
     else
     {
-      ctx.images = (image_s*)realloc(ctx.images, sizeof(image_s) * (ctx.images_size + 1));
+      ctx.images = (image_s*)pixelbox::alloc::realloc(ctx.images, sizeof(image_s) * (ctx.images_size + 1));
       if(ctx.images == NULL) return error_code_mem_alloc;
       //init the newly allocated image struct
       memset(ctx.images + ctx.images_size, 0, sizeof(image_s));
@@ -356,7 +357,7 @@ namespace img_parse
     {
       uint8_t sub_block_size = *(ctx.input + offset);
       if((ctx.input_size - offset) < ((uint32_t)sub_block_size + 1)) return error_code_out_of_bounds;      
-      image_pt->lzw = (uint8_t*)realloc(image_pt->lzw, image_pt->lzw_size + sub_block_size);
+      image_pt->lzw = (uint8_t*)pixelbox::alloc::realloc(image_pt->lzw, image_pt->lzw_size + sub_block_size);
       if(image_pt->lzw == NULL) return error_code_mem_alloc;
       memcpy(image_pt->lzw + image_pt->lzw_size, ctx.input + offset + 1, sub_block_size);
       image_pt->lzw_size += sub_block_size;
@@ -419,7 +420,7 @@ namespace img_parse
     deinit_code_table(image_pt);
     if(image_pt->lzw)
     {
-      free(image_pt->lzw);
+      pixelbox::alloc::free(image_pt->lzw);
       image_pt->lzw = NULL;
       image_pt->lzw_size = 0;
       image_pt->lzw_offset_bit = 0;
@@ -433,7 +434,7 @@ namespace img_parse
     //create RGBA array based on index stream and color tables
     color_s* color_table = image_pt->id.fields.local_color_table_flag ? image_pt->lct : ctx.gct;
     uint32_t color_table_size = image_pt->id.fields.local_color_table_flag ? image_pt->lct_size : ctx.gct_size;
-    image_pt->output = (color_s*)calloc(image_pt->index_stream_offset, sizeof(color_s));
+    image_pt->output = (color_s*)pixelbox::alloc::calloc(image_pt->index_stream_offset, sizeof(color_s));
     if(!image_pt->output) return error_code_mem_alloc;
     image_pt->output_size = image_pt->index_stream_offset;
     for(uint32_t i = 0; i < image_pt->index_stream_offset; i++)
@@ -472,6 +473,7 @@ namespace img_parse
   error_code_e parse_next_block(gif_parse_context_s& ctx)
   {
     if(ctx.parsed) return error_code_parsed;
+    if(ctx.offset >= ctx.input_size) return error_code_out_of_bounds; //missing trailer
 
     uint8_t block_label = *(ctx.input + ctx.offset);
 
@@ -498,8 +500,8 @@ namespace img_parse
       break;
     }
     default:
-      //handle unhandled blocks :)
-      break;
+      //unknown block, we can't tell its size to skip it
+      return error_code_not_supported;
     }
 
     return error_code_ok;
@@ -511,7 +513,7 @@ namespace img_parse
     memset(&ctx, 0, sizeof(ctx));
 
     //dynamically allocate mem for input and store the input data
-    ctx.input = (uint8_t*)calloc(input_size, 1);
+    ctx.input = (uint8_t*)pixelbox::alloc::calloc(input_size, 1);
     if(ctx.input == NULL) return error_code_mem_alloc;
     ctx.input_size = input_size;
     memcpy(ctx.input, input, ctx.input_size);
@@ -519,7 +521,20 @@ namespace img_parse
     return error_code_ok;
   }
 
-  error_code_e parse(gif_parse_context_s& ctx)
+  error_code_e init_buffer(gif_parse_context_s& ctx, uint32_t input_size)
+  {
+    //init the context struct
+    memset(&ctx, 0, sizeof(ctx));
+
+    //dynamically allocate mem for input, filled by the caller
+    ctx.input = (uint8_t*)pixelbox::alloc::calloc(input_size, 1);
+    if(ctx.input == NULL) return error_code_mem_alloc;
+    ctx.input_size = input_size;
+
+    return error_code_ok;
+  }
+
+  error_code_e parse_begin(gif_parse_context_s& ctx)
   {
     if(ctx.parsed) return error_code_parsed;
     error_code_e err;
@@ -527,30 +542,122 @@ namespace img_parse
     if(err != error_code_ok) return err;
     err = parse_lsd(ctx);
     if(err != error_code_ok) return err;
-    err = parse_gct(ctx);
+    return parse_gct(ctx);
+  }
+
+  error_code_e parse_step(gif_parse_context_s& ctx)
+  {
+    error_code_e err = parse_next_block(ctx);
+    if(err != error_code_ok) return err;
+
+    //we don't need the input after the trailer
+    if(ctx.parsed)
+    {
+      pixelbox::alloc::free(ctx.input);
+      ctx.input = NULL;
+      ctx.input_size = 0;
+      ctx.input_allocated = 0;
+    }
+    return error_code_ok;
+  }
+
+  error_code_e parse(gif_parse_context_s& ctx)
+  {
+    error_code_e err = parse_begin(ctx);
     if(err != error_code_ok) return err;
 
     while(!ctx.parsed)
     {
-      err = parse_next_block(ctx);
+      err = parse_step(ctx);
       if(err != error_code_ok) return err;
     }
+    return error_code_ok;
+  }
+
+  error_code_e init_stream(gif_parse_context_s& ctx, uint32_t reserve)
+  {
+    //init the context struct
+    memset(&ctx, 0, sizeof(ctx));
 
-    free(ctx.input);
-    ctx.input = NULL;
-    ctx.input_size = 0;
+    //reserve the expected size, append() grows it if needed
+    if(reserve == 0) return error_code_ok;
+    ctx.input = (uint8_t*)pixelbox::alloc::malloc(reserve);
+    if(ctx.input == NULL) return error_code_mem_alloc;
+    ctx.input_allocated = reserve;
     return error_code_ok;
   }
 
+  error_code_e append(gif_parse_context_s& ctx, const uint8_t* data, uint32_t len)
+  {
+    if(ctx.parsed) return error_code_ok; //anything after the trailer is ignored
+
+    //grow the input buffer, the parser only keeps offsets into it
+    if(ctx.input_size + len > ctx.input_allocated)
+    {
+      uint32_t allocated = ctx.input_allocated * 2 > ctx.input_size + len ? ctx.input_allocated * 2 : ctx.input_size + len;
+      uint8_t* grown = (uint8_t*)pixelbox::alloc::realloc(ctx.input, allocated);
+      if(grown == NULL) return error_code_mem_alloc;
+      ctx.input = grown;
+      ctx.input_allocated = allocated;
+    }
+    memcpy(ctx.input + ctx.input_size, data, len);
+    ctx.input_size += len;
+    return error_code_ok;
+  }
+
+  bool begin_complete(const gif_parse_context_s& ctx)
+  {
+    if(ctx.input_size < 6 + 7) return false; //header, lsd
+    uint8_t fields = ctx.input[6 + 4];
+    if(!(fields & 0x80)) return true; //no gct
+    return ctx.input_size >= (uint32_t)(6 + 7 + (0x01 << ((fields & 0x07) + 1)) * 3);
+  }
+
+  bool step_complete(const gif_parse_context_s& ctx)
+  {
+    if(ctx.parsed || ctx.offset >= ctx.input_size) return false;
+
+    //find the data sub-blocks of the next block
+    uint32_t offset = ctx.offset;
+    switch (ctx.input[offset])
+    {
+    case block_type_trailer:
+      return true;
+    case block_type_extension_introducer:
+      offset += 2; //introducer, label
+      break;
+    case block_type_image_descriptor:
+    {
+      if(ctx.input_size < offset + 10) return false;
+      uint8_t fields = ctx.input[offset + 9];
+      offset += 10;
+      if(fields & 0x80) offset += (0x01 << ((fields & 0x07) + 1)) * 3; //local color table
+      offset += 1; //lzw minimum code size
+      break;
+    }
+    default:
+      return true; //unknown block, parse_step() reports it
+    }
+
+    //walk the sub-blocks until the block terminator
+    while(offset < ctx.input_size)
+    {
+      uint8_t sub_block_size = ctx.input[offset];
+      if(sub_block_size == 0) return true;
+      offset += 1 + sub_block_size;
+    }
+    return false;
+  }
+
   void deinit(gif_parse_context_s& ctx)
   {
     //deallocate all dynamically allocated memory and zero the entire struct
-    if(ctx.input) free(ctx.input);
-    if(ctx.gct) free(ctx.gct);
+    if(ctx.input) pixelbox::alloc::free(ctx.input);
+    if(ctx.gct) pixelbox::alloc::free(ctx.gct);
     if(ctx.images)
     {
       for(uint32_t i = 0; i < ctx.images_size; i++) deinit_image(&ctx.images[i]);
-      free(ctx.images);
+      pixelbox::alloc::free(ctx.images);
     }
     memset(&ctx, 0, sizeof(ctx));
   }  
@@ -0,0 +1,174 @@
+#include "image_cache.hpp"
+
+#include "decoder.hpp"
+
+namespace pixelbox
+{
+  namespace image_cache
+  {
+    typedef struct slot_s
+    {
+      char name[CATALOG_NAME_MAX];
+      uint32_t stamp;
+      uint32_t bytes;       //heap used by the animation
+      uint32_t last_used;   //LRU counter value of the last access
+      bool used;
+      bool stale;           //removed while displayed, freed when an other image gets pinned
+      anim::animation_s anim;
+    } slot_s;
+
+    slot_s slots[IMAGE_CACHE_SLOTS];     //fixed slots, animation pointers stay valid while cached
+    anim::animation_s* pinned = NULL;
+    uint32_t budget = IMAGE_CACHE_BUDGET;
+    uint32_t use_counter = 0;
+    stats_s stats = {0, 0, 0, 0, 0};
+
+    slot_s* find(const String& name, uint32_t stamp)
+    {
+      for(uint32_t i = 0; i < IMAGE_CACHE_SLOTS; i++)
+        if(slots[i].used && !slots[i].stale && slots[i].stamp == stamp && name == slots[i].name) return &slots[i];
+      return NULL;
+    }
+
+    void free_slot(slot_s* slot)
+    {
+      if(pinned == &slot->anim) pinned = NULL;
+      anim::animation_init(&slot->anim);
+      stats.used_bytes -= slot->bytes;
+      stats.entries--;
+      memset(slot, 0, sizeof(slot_s));
+    }
+
+    slot_s* least_recently_used()
+    {
+      slot_s* lru = NULL;
+      for(uint32_t i = 0; i < IMAGE_CACHE_SLOTS; i++)
+      {
+        if(!slots[i].used || &slots[i].anim == pinned) continue;
+        if(lru == NULL || (int32_t)(slots[i].last_used - lru->last_used) < 0) lru = &slots[i];
+      }
+      return lru;
+    }
+
+    bool fits(uint32_t bytes)
+    {
+      //the budget is the configured one, but never more than what the free heap allows
+      if(stats.used_bytes + bytes > budget) return false;
+      return ESP.getFreeHeap() >= IMAGE_CACHE_MIN_FREE_HEAP;
+    }
+
+    anim::animation_s* get(const String& name, uint32_t stamp)
+    {
+      slot_s* slot = find(name, stamp);
+      if(slot == NULL)
+      {
+        stats.misses++;
+        return NULL;
+      }
+      stats.hits++;
+      slot->last_used = ++use_counter;
+      slot->anim.frame_index = 0;
+      return &slot->anim;
+    }
+
+    bool contains(const String& name, uint32_t stamp)
+    {
+      return find(name, stamp) != NULL;
+    }
+
+    anim::animation_s* put(const String& name, uint32_t stamp, anim::animation_s* decoded)
+    {
+      if(decoded == NULL || name.length() >= CATALOG_NAME_MAX) return NULL;
+
+      //a previous version of the same file is useless from now on
+      remove(name);
+
+      //evict until the new image fits (the decoded image is already on the heap, its size counts only against the budget)
+      uint32_t bytes = decoder::animation_bytes(decoded);
+      while(stats.used_bytes + bytes > budget)
+      {
+        slot_s* lru = least_recently_used();
+        if(lru == NULL) break; //only the pinned one left, the new image is kept anyway, it will be displayed
+        free_slot(lru);
+        stats.evictions++;
+      }
+
+      //find a free slot, or evict one
+      slot_s* slot = NULL;
+      for(uint32_t i = 0; i < IMAGE_CACHE_SLOTS && slot == NULL; i++)
+        if(!slots[i].used) slot = &slots[i];
+      if(slot == NULL)
+      {
+        slot = least_recently_used();
+        if(slot == NULL) return NULL;
+        free_slot(slot);
+        stats.evictions++;
+      }
+
+      //move the decoded data into the slot
+      strcpy(slot->name, name.c_str());
+      slot->stamp = stamp;
+      slot->bytes = bytes;
+      slot->last_used = ++use_counter;
+      slot->used = true;
+      slot->anim = *decoded;
+      slot->anim.frame_index = 0;
+      memset(decoded, 0, sizeof(anim::animation_s));
+      stats.used_bytes += bytes;
+      stats.entries++;
+
+      //give memory back if the heap is getting low
+      while(!fits(0))
+      {
+        slot_s* lru = least_recently_used();
+        if(lru == NULL || lru == slot) break;
+        free_slot(lru);
+        stats.evictions++;
+      }
+
+      return &slot->anim;
+    }
+
+    void pin(anim::animation_s* anim)
+    {
+      anim::animation_s* previous = pinned;
+      pinned = anim;
+
+      //the previously displayed image may have been removed meanwhile, it can be freed now
+      for(uint32_t i = 0; i < IMAGE_CACHE_SLOTS; i++)
+        if(slots[i].used && slots[i].stale && &slots[i].anim == previous && previous != anim) free_slot(&slots[i]);
+    }
+
+    void remove(const String& name)
+    {
+      for(uint32_t i = 0; i < IMAGE_CACHE_SLOTS; i++)
+      {
+        if(!slots[i].used || name != slots[i].name) continue;
+        if(&slots[i].anim == pinned) slots[i].stale = true; //still displayed, can't be freed yet
+        else free_slot(&slots[i]);
+      }
+    }
+
+    void set_budget(uint32_t bytes)
+    {
+      budget = bytes;
+      while(stats.used_bytes > budget)
+      {
+        slot_s* lru = least_recently_used();
+        if(lru == NULL) break;
+        free_slot(lru);
+        stats.evictions++;
+      }
+    }
+
+    uint32_t get_budget()
+    {
+      return budget;
+    }
+
+    stats_s get_stats()
+    {
+      return stats;
+    }
+  }
+}
@@ -1,76 +0,0 @@
-#include <FastLED.h>
-
-
-namespace pixelbox
-{
-namespace state_machine
-{
-
-CRGB connecting_image[64] = {
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(75, 128, 202),
-  CRGB(104, 194, 211),
-  CRGB(104, 194, 211),
-  CRGB(162, 220, 199),
-  CRGB(237, 225, 158),
-  CRGB(237, 225, 158),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(75, 128, 202),
-  CRGB(104, 194, 211),
-  CRGB(104, 194, 211),
-  CRGB(162, 220, 199),
-  CRGB(237, 225, 158),
-  CRGB(211, 160, 104),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(75, 128, 202),
-  CRGB(104, 194, 211),
-  CRGB(104, 194, 211),
-  CRGB(162, 220, 199),
-  CRGB(211, 160, 104),
-  CRGB(211, 160, 104),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(75, 128, 202),
-  CRGB(104, 194, 211),
-  CRGB(104, 194, 211),
-  CRGB(138, 176, 96),
-  CRGB(211, 160, 104),
-  CRGB(211, 160, 104),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(75, 128, 202),
-  CRGB(104, 194, 211),
-  CRGB(138, 176, 96),
-  CRGB(138, 176, 96),
-  CRGB(211, 160, 104),
-  CRGB(211, 160, 104),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(75, 128, 202),
-  CRGB(194, 211, 104),
-  CRGB(138, 176, 96),
-  CRGB(138, 176, 96),
-  CRGB(211, 160, 104),
-  CRGB(211, 160, 104),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82),
-  CRGB(75, 128, 202),
-  CRGB(194, 211, 104),
-  CRGB(194, 211, 104),
-  CRGB(138, 176, 96),
-  CRGB(138, 176, 96),
-  CRGB(211, 160, 104),
-  CRGB(211, 160, 104),
-  CRGB(180, 82, 82),
-  CRGB(180, 82, 82)
-};
-}
-}
\ No newline at end of file
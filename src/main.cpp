@@ -7,15 +7,30 @@
 #include "wifi_manager.hpp"
 #include "button.hpp"
 #include "state_machine.hpp"
+#include "settings.hpp"
+#include "catalog.hpp"
+#include "predecode.hpp"
+#include "file_writer.hpp"
+#include "store.hpp"
+#include "fs_usage.hpp"
+#include "events.hpp"
+#include "mirror.hpp"
+#include "realtime.hpp"
 
 void setup()
 {  
   pixelbox::ws2812b_8x8::setup();
   pixelbox::wifi_manager::setup();
+  pixelbox::settings::setup();
+  pixelbox::file_writer::setup();
+  pixelbox::store::setup();
+  pixelbox::fs_usage::setup();
+  pixelbox::catalog::setup();
   pixelbox::web::setup();
   pixelbox::state_machine::setup();  
   pixelbox::button::setup(pixelbox::state_machine::click_cb);
   pixelbox::web::add_updated_cb(pixelbox::state_machine::image_updated);  
+  pixelbox::realtime::setup(pixelbox::state_machine::image_updated);
 }
 
 void loop()
@@ -23,4 +38,10 @@ void loop()
   pixelbox::ws2812b_8x8::loop();
   pixelbox::wifi_manager::loop();
   pixelbox::button::loop();
+  pixelbox::settings::loop();
+  pixelbox::store::loop();
+  pixelbox::predecode::loop();
+  pixelbox::events::loop();
+  pixelbox::mirror::loop();
+  pixelbox::realtime::loop();
 }
\ No newline at end of file
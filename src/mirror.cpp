@@ -0,0 +1,126 @@
+#include "mirror.hpp"
+
+#include "ws2812b_8x8.hpp"
+
+#define MIRROR_FULL_HEADER_SIZE  5
+#define MIRROR_DELTA_ENTRY_SIZE  5
+
+namespace pixelbox
+{
+  namespace mirror
+  {
+    typedef struct client_s
+    {
+      uint32_t id;
+      bool used;
+      bool synced;              //got a full frame, deltas can be sent
+      uint32_t sequence;        //sequence of the last frame sent
+      uint32_t last_sent_ms;
+      CRGB sent[WS_LED_NUM];    //last frame sent, base of the deltas
+    } client_s;
+
+    AsyncWebSocket socket("/framebuffer");
+    client_s clients[MIRROR_MAX_CLIENTS];
+    CRGB latest[WS_LED_NUM];    //last committed frame
+    uint32_t latest_sequence = 0;
+    uint8_t message[MIRROR_FULL_HEADER_SIZE + WS_LED_NUM * 3]; //a delta is only sent if smaller than a full frame
+
+    void frame_committed(const CRGB* frame)
+    {
+      //only copied here, sending is done from loop() with per client rate limiting
+      memcpy(latest, frame, sizeof(latest));
+      latest_sequence++;
+    }
+
+    void on_event(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len)
+    {
+      if(type == WS_EVT_CONNECT)
+      {
+        for(uint32_t i = 0; i < MIRROR_MAX_CLIENTS; i++)
+        {
+          if(clients[i].used) continue;
+          clients[i].used = true;
+          clients[i].synced = false;
+          clients[i].sequence = latest_sequence - 1; //send the actual frame right away
+          clients[i].last_sent_ms = millis() - MIRROR_MIN_INTERVAL_MS;
+          clients[i].id = client->id();
+          return;
+        }
+      }
+      else if(type == WS_EVT_DISCONNECT)
+      {
+        for(uint32_t i = 0; i < MIRROR_MAX_CLIENTS; i++)
+          if(clients[i].used && clients[i].id == client->id()) clients[i].used = false;
+      }
+    }
+
+    uint32_t build_message(client_s& state)
+    {
+      //delta of the changed pixels if the client has a base frame and the delta is smaller than a full frame
+      uint32_t len = 0;
+      if(state.synced)
+      {
+        message[len++] = 0x01;
+        for(uint32_t i = 0; i < WS_LED_NUM; i++)
+        {
+          if(latest[i] == state.sent[i]) continue;
+          if(len + MIRROR_DELTA_ENTRY_SIZE > sizeof(message))
+          {
+            len = 0;
+            break;
+          }
+          message[len++] = i & 0xFF;
+          message[len++] = i >> 8;
+          message[len++] = latest[i].r;
+          message[len++] = latest[i].g;
+          message[len++] = latest[i].b;
+        }
+        if(len == 1) return 0; //nothing changed
+        if(len > 0) return len;
+      }
+
+      message[0] = 0x00;
+      message[1] = WS_LED_WIDTH & 0xFF;
+      message[2] = WS_LED_WIDTH >> 8;
+      message[3] = WS_LED_HEIGHT & 0xFF;
+      message[4] = WS_LED_HEIGHT >> 8;
+      memcpy(message + MIRROR_FULL_HEADER_SIZE, latest, WS_LED_NUM * 3);
+      return sizeof(message);
+    }
+
+    void setup(AsyncWebServer& server)
+    {
+      socket.onEvent(on_event);
+      server.addHandler(&socket);
+      ws2812b_8x8::set_frame_cb(frame_committed);
+    }
+
+    void loop()
+    {
+      socket.cleanupClients(MIRROR_MAX_CLIENTS);
+
+      for(uint32_t i = 0; i < MIRROR_MAX_CLIENTS; i++)
+      {
+        client_s& state = clients[i];
+        if(!state.used || state.sequence == latest_sequence) continue;
+        if(millis() - state.last_sent_ms < MIRROR_MIN_INTERVAL_MS) continue;
+
+        //a client with a full queue (slow link) skips frames instead of buffering them
+        AsyncWebSocketClient* client = socket.client(state.id);
+        if(client == NULL || client->status() != WS_CONNECTED || !client->canSend() || client->queueIsFull()) continue;
+
+        uint32_t len = build_message(state);
+        if(len == 0)
+        {
+          state.sequence = latest_sequence;
+          continue;
+        }
+        client->binary(message, len);
+        memcpy(state.sent, latest, sizeof(latest));
+        state.synced = true;
+        state.sequence = latest_sequence;
+        state.last_sent_ms = millis();
+      }
+    }
+  }
+}
@@ -0,0 +1,427 @@
+#ifdef PIXELBOX_PACKED_STORE //only built with the packed store backend
+
+#include "pack.hpp"
+
+#include "fs_usage.hpp"
+
+namespace pixelbox
+{
+  namespace pack
+  {
+    typedef struct index_header_s  //start of the index file, followed by count entry_s
+    {
+      uint32_t magic;
+      uint32_t covered;            //pack bytes described by the index
+      uint32_t dead_bytes;
+      uint32_t count;
+    } index_header_s;
+
+    entry_s* entries = NULL;       //sorted by hash
+    uint32_t entries_size = 0;
+    uint32_t entries_allocated = 0;
+    uint32_t open_files = 0;       //contents opened by readers, the pack is not replaced meanwhile
+    uint32_t index_size = 0;       //for the filesystem usage counters
+    stats_s stats = {0, 0, 0, 0, 0};
+
+    //compaction state
+    bool compacting = false;
+    File compact_dst;
+    uint32_t compact_next = 0;     //index of the entry being copied
+    uint32_t compact_copied = 0;   //bytes of that entry copied
+    uint32_t compact_checked_ms = 0;
+    uint32_t compact_size = 0;     //bytes written to the new pack
+
+    void compact_abort();
+
+    //binary search, returns the index of the entry or the insert position if not found
+    uint32_t lower_bound(const char* hash, bool& found)
+    {
+      uint32_t lo = 0, hi = entries_size;
+      while(lo < hi)
+      {
+        uint32_t mid = (lo + hi) / 2;
+        if(strcmp(entries[mid].hash, hash) < 0) lo = mid + 1;
+        else hi = mid;
+      }
+      found = lo < entries_size && strcmp(entries[lo].hash, hash) == 0;
+      return lo;
+    }
+
+    int32_t find(const char* hash)
+    {
+      bool found;
+      uint32_t index = lower_bound(hash, found);
+      return found ? index : -1;
+    }
+
+    bool contains(const char* hash)
+    {
+      return find(hash) >= 0;
+    }
+
+    uint32_t count()
+    {
+      return entries_size;
+    }
+
+    const entry_s* at(uint32_t index)
+    {
+      if(index >= entries_size) return NULL;
+      return &entries[index];
+    }
+
+    stats_s get_stats()
+    {
+      stats.contents = entries_size;
+      return stats;
+    }
+
+    bool add_entry(const char* hash, uint32_t offset, uint32_t size)
+    {
+      entry_s entry;
+      strncpy(entry.hash, hash, CONTENT_HASH_HEX_SIZE - 1);
+      entry.hash[CONTENT_HASH_HEX_SIZE - 1] = '\0';
+      entry.offset = offset;
+      entry.size = size;
+      entry.new_offset = 0;
+      bool found;
+      uint32_t index = lower_bound(entry.hash, found);
+      if(found) return false; //a content is stored once
+
+      //grow the array if necessary
+      if(entries_size == entries_allocated)
+      {
+        entry_s* new_entries = (entry_s*)realloc(entries, (entries_allocated + PACK_ALLOCATION_SIZE) * sizeof(entry_s));
+        if(new_entries == NULL) return false;
+        entries = new_entries;
+        entries_allocated += PACK_ALLOCATION_SIZE;
+      }
+
+      //keep the array sorted
+      memmove(&entries[index + 1], &entries[index], (entries_size - index) * sizeof(entry_s));
+      entries[index] = entry;
+      entries_size++;
+      stats.live_bytes += sizeof(record_s) + size;
+
+      //the compaction walks the entries by index, an entry inserted before its position would be missed
+      if(compacting && (index < compact_next || (index == compact_next && compact_copied > 0))) compact_abort();
+      return true;
+    }
+
+    void remove_entry(uint32_t index)
+    {
+      uint32_t bytes = sizeof(record_s) + entries[index].size;
+      stats.live_bytes -= bytes;
+      stats.dead_bytes += bytes;
+      memmove(&entries[index], &entries[index + 1], (entries_size - index - 1) * sizeof(entry_s));
+      entries_size--;
+
+      //the compaction walks the entries by index, don't let it skip one
+      if(compacting && index < compact_next) compact_next--;
+      else if(compacting && index == compact_next && compact_copied > 0) compact_abort(); //a partial record would break the scan of the new pack
+    }
+
+    bool append_record(const record_s& record, File* src, uint32_t& offset)
+    {
+      File f = LittleFS.open(PACK_FILE, "a");
+      if(!f) return false;
+      uint32_t start = f.size();
+      offset = start + sizeof(record);
+
+      bool ok = f.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+      uint8_t buffer[PACK_COPY_SIZE];
+      uint32_t left = record.size == PACK_TOMBSTONE ? 0 : record.size;
+      while(ok && left > 0)
+      {
+        uint32_t len = left > sizeof(buffer) ? sizeof(buffer) : left;
+        ok = src->read(buffer, len) == len && f.write(buffer, len) == len;
+        left -= len;
+      }
+
+      //a failed append is cut off, the next record starts right after the last complete one
+      if(!ok) f.truncate(start);
+      stats.file_size = f.size();
+      f.close();
+      fs_usage::resized(start, stats.file_size);
+      return ok;
+    }
+
+    bool append(const String& path, const char* hash)
+    {
+      File src = LittleFS.open(path, "r");
+      if(!src) return false;
+
+      record_s record;
+      record.magic = PACK_MAGIC;
+      record.size = src.size();
+      memcpy(record.hash, hash, sizeof(record.hash));
+      uint32_t offset;
+      bool ok = record.size != PACK_TOMBSTONE && append_record(record, &src, offset);
+      src.close();
+      return ok && add_entry(hash, offset, record.size);
+    }
+
+    bool remove(const char* hash)
+    {
+      int32_t index = find(hash);
+      if(index < 0) return false;
+
+      record_s record;
+      record.magic = PACK_MAGIC;
+      record.size = PACK_TOMBSTONE;
+      memcpy(record.hash, hash, sizeof(record.hash));
+      uint32_t offset;
+      if(!append_record(record, NULL, offset)) return false;
+      remove_entry(index);
+      stats.dead_bytes += sizeof(record_s);
+      return true;
+    }
+
+    bool open(const char* hash, File& file, uint32_t& offset, uint32_t& size)
+    {
+      int32_t index = find(hash);
+      if(index < 0) return false;
+
+      //no directory walk: the offset is in the index, found by a binary search in RAM
+      file = LittleFS.open(PACK_FILE, "r");
+      if(!file) return false;
+      if(!file.seek(entries[index].offset))
+      {
+        file.close();
+        return false;
+      }
+      offset = entries[index].offset;
+      size = entries[index].size;
+      open_files++;
+      return true;
+    }
+
+    void close(File& file)
+    {
+      if(!file) return;
+      file.close();
+      if(open_files > 0) open_files--;
+    }
+
+    bool save_index()
+    {
+      //written aside and renamed, a reset while writing leaves the previous index intact
+      File f = LittleFS.open(PACK_INDEX_TEMP, "w");
+      if(!f) return false;
+      index_header_s header = {PACK_MAGIC, stats.file_size, stats.dead_bytes, entries_size};
+      bool ok = f.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+      if(ok && entries_size > 0) ok = f.write((const uint8_t*)entries, entries_size * sizeof(entry_s)) == entries_size * sizeof(entry_s);
+      f.close();
+      uint32_t size = sizeof(header) + entries_size * sizeof(entry_s);
+      fs_usage::resized(0, size);
+      if(ok) ok = LittleFS.rename(PACK_INDEX_TEMP, PACK_INDEX_FILE);
+      if(!ok)
+      {
+        LittleFS.remove(PACK_INDEX_TEMP);
+        fs_usage::resized(size, 0);
+        return false;
+      }
+      fs_usage::resized(index_size, 0);
+      index_size = size;
+      return true;
+    }
+
+    uint32_t load_index(uint32_t pack_size)
+    {
+      //returns the pack offset the index is valid up to, 0 if there is no usable index
+      File f = LittleFS.open(PACK_INDEX_FILE, "r");
+      if(!f) return 0;
+      index_size = f.size();
+      index_header_s header;
+      bool ok = f.read((uint8_t*)&header, sizeof(header)) == sizeof(header);
+      ok = ok && header.magic == PACK_MAGIC && header.covered <= pack_size && f.size() == sizeof(header) + header.count * sizeof(entry_s);
+      for(uint32_t i = 0; ok && i < header.count; i++)
+      {
+        entry_s entry;
+        ok = f.read((uint8_t*)&entry, sizeof(entry)) == sizeof(entry) && add_entry(entry.hash, entry.offset, entry.size);
+      }
+      f.close();
+      if(!ok)
+      {
+        entries_size = 0;
+        stats.live_bytes = 0;
+        return 0;
+      }
+      stats.dead_bytes = header.dead_bytes;
+      return header.covered;
+    }
+
+    uint32_t scan(File& f, uint32_t offset)
+    {
+      //read the record headers from offset, returns the end of the last complete record
+      uint32_t pack_size = f.size();
+      record_s record;
+      while(offset + sizeof(record) <= pack_size)
+      {
+        if(!f.seek(offset) || f.read((uint8_t*)&record, sizeof(record)) != sizeof(record) || record.magic != PACK_MAGIC) break;
+
+        char hash[CONTENT_HASH_HEX_SIZE];
+        memcpy(hash, record.hash, sizeof(record.hash));
+        hash[CONTENT_HASH_HEX_SIZE - 1] = '\0';
+        int32_t index = find(hash);
+
+        if(record.size == PACK_TOMBSTONE)
+        {
+          if(index >= 0) remove_entry(index);
+          stats.dead_bytes += sizeof(record);
+          offset += sizeof(record);
+          continue;
+        }
+        if(offset + sizeof(record) + record.size > pack_size) break; //cut by a reset while appending
+
+        if(index >= 0) stats.dead_bytes += sizeof(record) + record.size; //stored twice, the first one is used
+        else add_entry(hash, offset + sizeof(record), record.size);
+        offset += sizeof(record) + record.size;
+      }
+      return offset;
+    }
+
+    void setup()
+    {
+      //an interrupted compaction is started over
+      LittleFS.remove(PACK_COMPACT_FILE);
+
+      File f = LittleFS.open(PACK_FILE, "r");
+      if(!f) return;
+      uint32_t pack_size = f.size();
+      uint32_t covered = load_index(pack_size);
+      uint32_t end = scan(f, covered);
+      f.close();
+
+      if(end < pack_size)
+      {
+        f = LittleFS.open(PACK_FILE, "r+");
+        if(f)
+        {
+          f.truncate(end);
+          f.close();
+        }
+      }
+      stats.file_size = end;
+      if(end != covered) save_index();
+    }
+
+    void compact_begin()
+    {
+      compact_dst = LittleFS.open(PACK_COMPACT_FILE, "w");
+      if(!compact_dst)
+      {
+        LittleFS.remove(PACK_COMPACT_FILE);
+        return;
+      }
+      compact_next = 0;
+      compact_copied = 0;
+      compact_size = 0;
+      compacting = true;
+    }
+
+    void compact_abort()
+    {
+      compact_dst.close();
+      if(LittleFS.remove(PACK_COMPACT_FILE)) fs_usage::resized(compact_size, 0);
+      compacting = false;
+    }
+
+    bool compact_step(File& src)
+    {
+      //copy a piece of the next live content, returns false when every content is copied
+      if(compact_next >= entries_size) return false;
+      entry_s& entry = entries[compact_next];
+
+      if(compact_copied == 0)
+      {
+        record_s record;
+        record.magic = PACK_MAGIC;
+        record.size = entry.size;
+        memcpy(record.hash, entry.hash, sizeof(record.hash));
+        if(compact_dst.write((const uint8_t*)&record, sizeof(record)) != sizeof(record))
+        {
+          compact_abort();
+          return false;
+        }
+        entry.new_offset = compact_dst.size();
+      }
+
+      uint8_t buffer[PACK_COPY_SIZE];
+      uint32_t len = entry.size - compact_copied > sizeof(buffer) ? sizeof(buffer) : entry.size - compact_copied;
+      if(!src.seek(entry.offset + compact_copied) || src.read(buffer, len) != len || compact_dst.write(buffer, len) != len)
+      {
+        compact_abort();
+        return false;
+      }
+      compact_copied += len;
+      if(compact_copied == entry.size)
+      {
+        compact_next++;
+        compact_copied = 0;
+      }
+      return true;
+    }
+
+    void compact_finish()
+    {
+      uint32_t new_size = compact_dst.size();
+      compact_dst.close();
+
+      //without an index the new pack is scanned on boot, an index of the old one must never describe it
+      if(LittleFS.remove(PACK_INDEX_FILE)) fs_usage::resized(index_size, 0);
+      index_size = 0;
+      if(!LittleFS.rename(PACK_COMPACT_FILE, PACK_FILE))
+      {
+        if(LittleFS.remove(PACK_COMPACT_FILE)) fs_usage::resized(compact_size, 0);
+        compacting = false;
+        return;
+      }
+      fs_usage::resized(stats.file_size, 0); //the old pack
+
+      //contents deleted while compacting were copied too, they are the only dead bytes left
+      for(uint32_t i = 0; i < entries_size; i++) entries[i].offset = entries[i].new_offset;
+      stats.file_size = new_size;
+      stats.dead_bytes = new_size - stats.live_bytes;
+      stats.compactions++;
+      compacting = false;
+      save_index();
+    }
+
+    void loop()
+    {
+      if(!compacting)
+      {
+        //only worth it if a good part of the pack is dead, and the live part must fit next to it
+        if(stats.dead_bytes < PACK_COMPACT_MIN_DEAD || stats.dead_bytes * 4 < stats.file_size) return;
+        if(millis() - compact_checked_ms < PACK_COMPACT_RETRY_MS) return;
+        compact_checked_ms = millis();
+        if(fs_usage::free_space() < stats.live_bytes + 2 * fs_usage::block_size()) return;
+        compact_begin();
+        return;
+      }
+
+      //opened for every slice, it sees the records appended meanwhile
+      File src = LittleFS.open(PACK_FILE, "r");
+      if(!src)
+      {
+        compact_abort();
+        return;
+      }
+      uint32_t start = micros();
+      bool copying = true;
+      while(copying && micros() - start < PACK_COMPACT_SLICE_US) copying = compact_step(src);
+      src.close();
+      if(compacting)
+      {
+        fs_usage::resized(compact_size, compact_dst.size());
+        compact_size = compact_dst.size();
+      }
+
+      //readers use the offsets of the old pack, wait for them
+      if(!copying && compacting && open_files == 0) compact_finish();
+    }
+  }
+}
+
+#endif
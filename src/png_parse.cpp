@@ -1,4 +1,5 @@
 #include "png_parse.hpp"
+#include "alloc.hpp"
 
 #include <tinf.h>
 #include <cstring>
@@ -31,7 +32,7 @@ namespace img_parse
 
     //if the chunk would be bigger than the remaining bytes, it's invalid
     cd.len = read_u32(ctx, 0);
-    if(remaining < (cd.len + 4 + 4)) return false;
+    if(remaining - 12 < cd.len) return false;
 
     //check the integrity of the chunk with crc32
     cd.crc32 = read_u32(ctx, cd.len + 4 + 4);
@@ -164,9 +165,7 @@ namespace img_parse
       for(uint32_t i = 0; i < ctx.stride; i++)
       {
         ctx.unfiltered_data[ctx.stride * ctx.scanline_index + i] = ctx.inflated_data[(ctx.stride + 1) * ctx.scanline_index + 1 + i];
-        if(ctx.scanline_index == 0)
-          return;
-        else
+        if(ctx.scanline_index > 0)
           ctx.unfiltered_data[ctx.stride * ctx.scanline_index + i] += ctx.unfiltered_data[ctx.stride * (ctx.scanline_index - 1) + i];
       }
       break;
@@ -308,7 +307,7 @@ namespace img_parse
     ctx.offset += 4 + 4; //len, type
 
     //allocate buffer for inflated data, can be calculated based on the ihdr data
-    ctx.inflated_data = (uint8_t*)calloc(ctx.hdr.height * (1 + ctx.hdr.width * ctx.pixel_size), 1);
+    ctx.inflated_data = (uint8_t*)pixelbox::alloc::calloc(ctx.hdr.height * (1 + ctx.hdr.width * ctx.pixel_size), 1);
     if(ctx.inflated_data == NULL) return false;
     ctx.inflated_size = ctx.hdr.height * (1 + ctx.hdr.width * ctx.pixel_size);
 
@@ -316,7 +315,7 @@ namespace img_parse
     int ret = tinf_uncompress(ctx.inflated_data, &ctx.inflated_size, ctx.data + ctx.offset + 2, cd.len);
     if(ret != TINF_OK)
     {
-      free(ctx.inflated_data);
+      pixelbox::alloc::free(ctx.inflated_data);
       ctx.inflated_data = NULL;
       ctx.inflated_size = 0;
       return false;
@@ -325,7 +324,7 @@ namespace img_parse
     //check the inflated size if it matches the ihdr based size
     if(ctx.inflated_size != ctx.hdr.height * (1 + ctx.hdr.width * ctx.pixel_size))
     {
-      free(ctx.inflated_data);
+      pixelbox::alloc::free(ctx.inflated_data);
       ctx.inflated_data = NULL;
       ctx.inflated_size = 0;
       return false;
@@ -335,10 +334,10 @@ namespace img_parse
     ctx.stride = ctx.hdr.width * ctx.pixel_size;
 
     //allocated buffor for the image representation
-    ctx.unfiltered_data = (uint8_t*)calloc(ctx.hdr.height * ctx.stride, 1);
+    ctx.unfiltered_data = (uint8_t*)pixelbox::alloc::calloc(ctx.hdr.height * ctx.stride, 1);
     if(ctx.unfiltered_data == NULL)
     {
-      free(ctx.inflated_data);
+      pixelbox::alloc::free(ctx.inflated_data);
       ctx.inflated_data = NULL;
       ctx.inflated_size = 0;
       return false;
@@ -350,7 +349,7 @@ namespace img_parse
       unfilter_scanline(ctx);
 
     //we don't need the infalted data buffer any more, deallocating it
-    free(ctx.inflated_data);
+    pixelbox::alloc::free(ctx.inflated_data);
     ctx.inflated_data = NULL;
     ctx.inflated_size = 0;
 
@@ -438,7 +437,7 @@ namespace img_parse
     memset(&ctx, 0, sizeof(ctx));
 
     //allooc memory for input data
-    ctx.data = (uint8_t*)calloc(len, 1);
+    ctx.data = (uint8_t*)pixelbox::alloc::calloc(len, 1);
     if(ctx.data == NULL) return false;
     ctx.size = len;
 
@@ -447,17 +446,73 @@ namespace img_parse
     return true;
   }
 
+  bool init_buffer(png_parse_context_s& ctx, uint32_t len)
+  {
+    //zero everything in context
+    memset(&ctx, 0, sizeof(ctx));
+
+    //allooc memory for input data, filled by the caller
+    ctx.data = (uint8_t*)pixelbox::alloc::calloc(len, 1);
+    if(ctx.data == NULL) return false;
+    ctx.size = len;
+    return true;
+  }
+
+  bool init_stream(png_parse_context_s& ctx, uint32_t reserve)
+  {
+    //zero everything in context
+    memset(&ctx, 0, sizeof(ctx));
+
+    //reserve the expected size, append() grows it if needed
+    if(reserve == 0) return true;
+    ctx.data = (uint8_t*)pixelbox::alloc::malloc(reserve);
+    if(ctx.data == NULL) return false;
+    ctx.allocated = reserve;
+    return true;
+  }
+
+  bool append(png_parse_context_s& ctx, const uint8_t* data, uint32_t len)
+  {
+    if(ctx.parsed) return true; //anything after IEND is ignored
+
+    //grow the input buffer, the parser only keeps offsets into it
+    if(ctx.size + len > ctx.allocated)
+    {
+      uint32_t allocated = ctx.allocated * 2 > ctx.size + len ? ctx.allocated * 2 : ctx.size + len;
+      uint8_t* grown = (uint8_t*)pixelbox::alloc::realloc(ctx.data, allocated);
+      if(grown == NULL) return false;
+      ctx.data = grown;
+      ctx.allocated = allocated;
+    }
+    memcpy(ctx.data + ctx.size, data, len);
+    ctx.size += len;
+    return true;
+  }
+
+  bool begin_complete(const png_parse_context_s& ctx)
+  {
+    return ctx.size >= 8 + 4 + 4 + 13 + 4; //signature, IHDR (len, type, data, crc32)
+  }
+
+  bool step_complete(const png_parse_context_s& ctx)
+  {
+    if(ctx.parsed || ctx.size < ctx.offset + 12) return false;
+    const uint8_t* p = ctx.data + ctx.offset;
+    uint32_t len = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    return ctx.size - ctx.offset - 12 >= len;
+  }
+
   void deinit(png_parse_context_s& ctx)
   {
     //free all allocated memory
-    if(ctx.data) free(ctx.data);
-    if(ctx.inflated_data) free(ctx.inflated_data);
-    if(ctx.unfiltered_data) free(ctx.unfiltered_data);
+    if(ctx.data) pixelbox::alloc::free(ctx.data);
+    if(ctx.inflated_data) pixelbox::alloc::free(ctx.inflated_data);
+    if(ctx.unfiltered_data) pixelbox::alloc::free(ctx.unfiltered_data);
     //zero everything
     memset(&ctx, 0, sizeof(ctx));
   }
 
-  bool parse(png_parse_context_s& ctx)
+  bool parse_begin(png_parse_context_s& ctx)
   {
     //check the png header and the first ihdr
     if(!check_header(ctx)) return false;
@@ -473,14 +528,31 @@ namespace img_parse
     else
       return false;
 
+    return true;
+  }
+
+  bool parse_step(png_parse_context_s& ctx)
+  {
+    if(!parse_next_chunk(ctx)) return false;
+
+    //deallocate raw input buffer after the iend chunk
+    if(ctx.parsed)
+    {
+      pixelbox::alloc::free(ctx.data);
+      ctx.data = NULL;
+      ctx.size = 0;
+      ctx.allocated = 0;
+    }
+    return true;
+  }
+
+  bool parse(png_parse_context_s& ctx)
+  {
+    if(!parse_begin(ctx)) return false;
+
     //parse the following chunks until the first iend chunk is not found
     while (!ctx.parsed)
-      if(!parse_next_chunk(ctx)) return false;
-
-    //deallocate raw input buffer
-    free(ctx.data);
-    ctx.data = NULL;
-    ctx.size = 0;
+      if(!parse_step(ctx)) return false;
     return true;
   }
 }
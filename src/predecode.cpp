@@ -0,0 +1,122 @@
+#include "predecode.hpp"
+
+#include "settings.hpp"
+#include "catalog.hpp"
+#include "decoder.hpp"
+#include "image_cache.hpp"
+
+namespace pixelbox
+{
+  namespace predecode
+  {
+    decoder::job_s job;
+    String displayed;           //displayed image the job was started for
+    uint32_t displayed_since = 0;
+    String failed_name;         //don't retry an image that failed to decode until it changes
+    uint32_t failed_stamp = 0;
+    bool estimate_only = false; //the job only estimates the current of an image the catalog has no estimate for, the result isn't cached
+    uint32_t estimate_version = 0;  //catalog version of the running estimate pass
+    uint32_t estimate_index = 0;    //next catalog index of the pass
+
+    void store()
+    {
+      //move the result into the cache, unpinned but as the most recently used entry: it's the image the next click displays,
+      //older entries are evicted before it
+      uint32_t peak_ma, avg_ma;
+      anim::estimate_current(&job.anim, peak_ma, avg_ma);
+      catalog::set_current_estimate(job.name, peak_ma, avg_ma);
+      if(!estimate_only) image_cache::put(job.name, job.stamp, &job.anim);
+      decoder::job_cancel(job);
+    }
+
+    void step()
+    {
+      uint32_t start = micros();
+      while(decoder::job_step(job) && micros() - start < PREDECODE_SLICE_US);
+
+      if(job.state == decoder::job_state_done) store();
+      else if(job.state == decoder::job_state_failed)
+      {
+        failed_name = job.name;
+        failed_stamp = job.stamp;
+        decoder::job_cancel(job);
+      }
+    }
+
+    void finish(const String& name, uint32_t stamp)
+    {
+      if(job.state == decoder::job_state_idle) return;
+      if(job.name != name || job.stamp != stamp)
+      {
+        decoder::job_cancel(job);
+        return;
+      }
+      while(decoder::job_step(job));
+      estimate_only = false; //it's about to be displayed, worth caching
+      if(job.state == decoder::job_state_done) store();
+      else decoder::job_cancel(job);
+    }
+
+    void start_estimate()
+    {
+      //one pass over the catalog after every change: images without a current estimate (stored before the boot,
+      //archive members) are decoded for it, so the list shows every image's current without displaying each one
+      if(estimate_version != catalog::version())
+      {
+        estimate_version = catalog::version();
+        estimate_index = 0;
+      }
+      while(estimate_index < catalog::count())
+      {
+        const catalog::entry_s* entry = catalog::at(estimate_index++);
+        if(entry->peak_ma > 0) continue;
+        estimate_only = true;
+        if(decoder::job_start(job, entry->name, entry->stamp)) return;
+      }
+    }
+
+    void loop()
+    {
+      //restart the idle timer when the displayed image changes
+      const String& current = settings::get().displayed_image;
+      if(current != displayed)
+      {
+        displayed = current;
+        displayed_since = millis();
+        if(job.state != decoder::job_state_idle) decoder::job_cancel(job);
+        return;
+      }
+
+      if(job.state != decoder::job_state_idle)
+      {
+        //the target may have been overwritten or deleted meanwhile
+        int32_t index = catalog::find(job.name);
+        if(index < 0 || catalog::at(index)->stamp != job.stamp)
+        {
+          decoder::job_cancel(job);
+          return;
+        }
+        step();
+        return;
+      }
+
+      if(millis() - displayed_since < PREDECODE_IDLE_MS) return;
+      if(ESP.getFreeHeap() < PREDECODE_MIN_FREE_HEAP) return;
+
+      //the next image is the one a click displays, with nothing to decode for it the missing estimates are next
+      const catalog::entry_s* next = catalog::next(displayed);
+      if(next == NULL || displayed == next->name || image_cache::contains(next->name, next->stamp) || (failed_stamp == next->stamp && failed_name == next->name))
+      {
+        start_estimate();
+        return;
+      }
+
+      estimate_only = false;
+      if(!decoder::job_start(job, next->name, next->stamp))
+      {
+        failed_name = next->name;
+        failed_stamp = next->stamp;
+      }
+    }
+  }
+}
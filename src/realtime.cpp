@@ -0,0 +1,72 @@
+#include "realtime.hpp"
+
+#include <ESPAsyncUDP.h>
+
+#include "mailbox.hpp"
+#include "ws2812b_8x8.hpp"
+
+namespace pixelbox
+{
+  namespace realtime
+  {
+    AsyncUDP udp;
+    mailbox::mailbox_t<WS_LED_NUM * 3> frames; //static buffers, no allocation per packet
+    ddp::stats_s ddp_stats = {0, 0, 0, 0, 0};  //written by the UDP callback only
+    voidcb timeout_cb = NULL;
+    bool active = false;
+    uint32_t last_frame_ms = 0;
+    uint32_t shown = 0;
+    uint32_t fps = 0;
+    uint32_t fps_shown = 0;                    //shown at the start of the fps window
+    uint32_t fps_window_ms = 0;
+
+    void on_packet(AsyncUDPPacket& packet)
+    {
+      //runs in the network stack's context: copy into the back buffer, hand over complete frames, nothing else
+      //a sender may update only a part of the frame (offset, then push), the next frame starts from the pushed one
+      if(ddp::receive(packet.data(), packet.length(), frames.back_buffer(), WS_LED_NUM * 3, ddp_stats)) frames.publish(true);
+    }
+
+    void setup(voidcb on_timeout)
+    {
+      timeout_cb = on_timeout;
+      if(udp.listen(DDP_PORT)) udp.onPacket(on_packet);
+    }
+
+    void loop()
+    {
+      const uint8_t* frame = frames.take();
+      if(frame)
+      {
+        //displayed immediately, not waiting for the render timer
+        ws2812b_8x8::set((CRGB*)frame);
+        active = true;
+        last_frame_ms = millis();
+        shown++;
+      }
+      else if(active && millis() - last_frame_ms >= REALTIME_TIMEOUT_MS)
+      {
+        active = false;
+        if(timeout_cb) timeout_cb();
+      }
+
+      if(millis() - fps_window_ms >= 1000)
+      {
+        fps = shown - fps_shown;
+        fps_shown = shown;
+        fps_window_ms = millis();
+      }
+    }
+
+    stats_s get_stats()
+    {
+      stats_s stats;
+      stats.ddp = ddp_stats;
+      stats.shown = shown;
+      stats.dropped = frames.dropped;
+      stats.fps = fps;
+      stats.active = active;
+      return stats;
+    }
+  }
+}
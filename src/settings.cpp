@@ -0,0 +1,125 @@
+#include "settings.hpp"
+
+#include <LittleFS.h>
+
+#include "fs_usage.hpp"
+
+namespace pixelbox
+{
+  namespace settings
+  {
+    settings_s values = {SETTINGS_DEFAULT_BRIGHTNESS, SETTINGS_DEFAULT_MAX_CURRENT, String()};
+    bool dirty = false;          //RAM values differ from the settings file
+    uint32_t changed_ms = 0;     //time of the last change, for debouncing the write
+    uint32_t file_size = 0;      //for the filesystem usage counters
+
+    const settings_s& get()
+    {
+      return values;
+    }
+
+    void mark_dirty()
+    {
+      dirty = true;
+      changed_ms = millis();
+    }
+
+    void set_brightness(uint8_t percent)
+    {
+      if(percent > 100) percent = 100;
+      if(values.brightness == percent) return;
+      values.brightness = percent;
+      mark_dirty();
+    }
+
+    void set_max_current(uint32_t current_ma)
+    {
+      if(values.max_current == current_ma) return;
+      values.max_current = current_ma;
+      mark_dirty();
+    }
+
+    void set_displayed_image(const String& filename)
+    {
+      if(values.displayed_image == filename) return;
+      values.displayed_image = filename;
+      mark_dirty();
+    }
+
+    bool flush()
+    {
+      if(!dirty) return true;
+
+      //one small file holding every setting as key=value lines
+      File f = LittleFS.open(SETTINGS_FILE, "w");
+      if(!f) return false;
+      String content;
+      content += "brightness=" + String(values.brightness) + "\n";
+      content += "max_current=" + String(values.max_current) + "\n";
+      content += "displayed_image=" + values.displayed_image + "\n";
+      uint32_t written = f.write((const uint8_t*)content.c_str(), content.length());
+      bool ok = written == content.length();
+      f.close();
+      fs_usage::resized(file_size, written); //"w" truncated the file, it holds what was written
+      file_size = written;
+
+      if(ok) dirty = false;
+      else changed_ms = millis(); //retry after the debounce interval
+      return ok;
+    }
+
+    void parse_line(const String& line)
+    {
+      int separator = line.indexOf('=');
+      if(separator < 0) return;
+      String key = line.substring(0, separator);
+      String value = line.substring(separator + 1);
+
+      if(key == "brightness") values.brightness = value.toInt() > 100 ? 100 : value.toInt();
+      else if(key == "max_current") values.max_current = value.toInt();
+      else if(key == "displayed_image") values.displayed_image = value;
+    }
+
+    bool load()
+    {
+      File f = LittleFS.open(SETTINGS_FILE, "r");
+      if(!f) return false;
+      file_size = f.size();
+      while(f.available()) parse_line(f.readStringUntil('\n'));
+      f.close();
+      return true;
+    }
+
+    bool load_legacy_file(const char* path, String& value)
+    {
+      File f = LittleFS.open(path, "r");
+      if(!f) return false;
+      value = f.readString();
+      f.close();
+      LittleFS.remove(path);
+      return true;
+    }
+
+    void load_legacy()
+    {
+      //older firmwares stored every setting in a separate file, move them into the settings file
+      String value;
+      if(load_legacy_file("/brightness", value)) values.brightness = value.toInt() > 100 ? 100 : value.toInt();
+      if(load_legacy_file("/max_current", value)) values.max_current = value.toInt();
+      if(load_legacy_file("/displayed_image", value)) values.displayed_image = value;
+      mark_dirty();
+      flush();
+    }
+
+    void setup()
+    {
+      LittleFS.begin();
+      if(!load()) load_legacy();
+    }
+
+    void loop()
+    {
+      if(dirty && (millis() - changed_ms) >= SETTINGS_FLUSH_DELAY_MS) flush();
+    }
+  }
+}
@@ -3,15 +3,18 @@
 #include <FastLED.h>
 
 #include "web.hpp"
-#include "gif_parse.hpp"
-#include "png_parse.hpp"
+#include "settings.hpp"
+#include "catalog.hpp"
+#include "decoder.hpp"
+#include "image_cache.hpp"
+#include "predecode.hpp"
+#include "assets.hpp"
 
 namespace pixelbox
 {
   namespace state_machine
   {
-    extern CRGB connecting_image[];        //image displayed on startup/during connecting to Wi-Fi
-    pixelbox::anim::animation_s animation; //animation data, for displaying GIF files
+    pixelbox::anim::animation_s asset_anim; //displayed built-in asset, the frames point into the flash
 
     void click_cb() //on click let's display the next stored image from flash
     { 
@@ -20,147 +23,94 @@ namespace pixelbox
       pixelbox::web::select_next_image(act);
     }
 
-    void image_updated() //on image updated try to parse and display image
+    void display(pixelbox::anim::animation_s* anim)
     {
-      //read the displayed image's name and open it
-      String filename;
-      if(!pixelbox::web::get_displayed_image(filename)) return;
-      File image_file = LittleFS.open("/images/" + filename, "r");
-      if(!image_file) return;
+      pixelbox::image_cache::pin(anim); //keep it in the cache while displayed
+      if(anim->frames_size == 1 && !anim->frames[0].mapped) //if it's an image, simply set it
+        pixelbox::ws2812b_8x8::set(anim->frames[0].pixels);
+      else
+        pixelbox::ws2812b_8x8::set(anim);
+    }
 
-      //currently only supports PNG and GIF, check the file extension
-      bool png = true;
-      if(filename.endsWith(".png")) png = true;
-      else if(filename.endsWith(".gif")) png = false;
-      else return;
+    bool show_asset(const char* name) //display a built-in asset right from flash, false if there is no such asset
+    {
+      const pixelbox::assets::region_s& region = pixelbox::assets::builtin();
+      int32_t asset_index = pixelbox::assets::find(region, name);
+      pixelbox::assets::asset_s asset;
+      if(asset_index < 0 || !pixelbox::assets::get(region, asset_index, asset)) return false;
 
-      //read image file into RAM
-      uint32_t img_size = image_file.size();
-      uint8_t* img_buf = (uint8_t*) malloc(img_size);
-      if(img_buf == NULL) return;
-      if((size_t)image_file.read((uint8_t*)img_buf, img_size) != img_size)
+      //animations only if they fit the display, otherwise the first frame centered and cropped
+      if(asset.width == WS_LED_WIDTH && asset.height == WS_LED_HEIGHT && pixelbox::assets::load(region, asset_index, &asset_anim))
       {
-        free(img_buf);
-        image_file.close();
-        return;
+        display(&asset_anim);
+        return true;
       }
-      image_file.close(); //we don't need the file to be open any more, close it
+      pixelbox::assets::frame_header_s header;
+      pixelbox::ws2812b_8x8::set((const CRGB*)pixelbox::assets::frame_pixels(region, asset, 0, header), asset.width, asset.height, true);
+      return true;
+    }
 
-      //temporary buffer for image data to be displayed
-      CRGB image[WS_LED_NUM];
+    void show_error()
+    {
+      if(!show_asset("error")) pixelbox::ws2812b_8x8::set_color(CRGB::Red); //display red color for error
+    }
 
-      if(png)
+    void image_updated() //on image updated try to parse and display image
+    {
+      //read the displayed image's name and look it up
+      String filename;
+      if(!pixelbox::web::get_displayed_image(filename)) return;
+      int32_t index = pixelbox::catalog::find(filename);
+      if(index < 0)
       {
-        //init the PNG parsing context
-        img_parse::png_parse_context_s ctx;
-        if(!img_parse::init(ctx, img_buf, img_size)) return;
-        free(img_buf); //after init, image data copied into the ctx, no need for the img_buf (can be optimized if we read the image data from flash right into the context)
-
-        //parse and check for error OR image with invalid size
-        if(!img_parse::parse(ctx) || (ctx.hdr.height != 8 || ctx.hdr.width != 8))
-        {
-          img_parse::deinit(ctx);
-          pixelbox::ws2812b_8x8::set_color(CRGB::Red); //display red color for error
-          return;
-        }
-
-        //export output pixel data from the context into the CRGB array to pass it to fastled
-        if(ctx.pixel_size == 3)
-          memcpy(image, ctx.unfiltered_data, sizeof(image));
-        else if(ctx.pixel_size == 4)
-        {
-          for(u8 i = 0; i < WS_LED_NUM; i++)
-          {
-            image[i].r = ctx.unfiltered_data[4*i+0];
-            image[i].g = ctx.unfiltered_data[4*i+1];
-            image[i].b = ctx.unfiltered_data[4*i+2];
-          }
-        }
-
-        //dealloc everything left from the parsing
-        img_parse::deinit(ctx);
-
-        //set the image to be displayed
-        pixelbox::ws2812b_8x8::set(image);
+        //not uploaded, maybe a built-in asset: displayed right from flash
+        show_asset(filename.c_str());
+        return;
       }
-      else
-      {
-        //init the GIF parsing context
-        img_parse::gif_parse_context_s ctx;        
-        if(img_parse::init(ctx, img_buf, img_size) != img_parse::error_code_ok) return;
-        free(img_buf); //after init, image data copied into the ctx, no need for the img_buf (can be optimized if we read the image data from flash right into the context)
-        
-        //parse and check for error OR image with invalid size
-        if(img_parse::parse(ctx) != img_parse::error_code_ok || (ctx.lsd.height != 8 || ctx.lsd.width != 8))
-        {
-          img_parse::deinit(ctx);
-          pixelbox::ws2812b_8x8::set_color(CRGB::Red); //display red color for error
-          return;
-        }
+      const pixelbox::catalog::entry_s* entry = pixelbox::catalog::at(index);
 
-        if(ctx.images_size == 1) //if it's an image, simply set it
-        {
-          memcpy(image, ctx.images[0].output, sizeof(image));
-          pixelbox::ws2812b_8x8::set(image);
-        }
-        else //if it's an animation export the frames into an animation and set it
-        {
-          pixelbox::anim::animation_init(&animation); //dealloc if necessary and zero everything
-          for(uint32_t i = 0; i < ctx.images_size; i++)
-          {
-            if(!ctx.images[i].gce.valid) continue; //skip frames without gce
-            pixelbox::anim::add_frame(&animation, 
-                            ctx.images[i].gce.delay_time_10ms * 10, 
-                            ctx.images[i].id.left_position, 
-                            ctx.images[i].id.top_position,
-                            (CRGB*)ctx.images[i].output,
-                            ctx.images[i].output_size);
-          }
-          pixelbox::ws2812b_8x8::set(&animation);
-        }
+      //the background decoder may be working on this image right now
+      pixelbox::predecode::finish(filename, entry->stamp);
 
-        //dealloc everything left from the parsing
-        img_parse::deinit(ctx);
+      //recently displayed images are still decoded in the cache, no flash read, no decode needed
+      pixelbox::anim::animation_s* cached = pixelbox::image_cache::get(filename, entry->stamp);
+      if(cached)
+      {
+        display(cached);
+        return;
       }
-    }
 
-    void load_brightness()
-    {
-      File f = LittleFS.open("/brightness", "r");
-      if(!f)
+      //parse the image from flash
+      pixelbox::anim::animation_s decoded;
+      memset(&decoded, 0, sizeof(decoded));
+      if(!pixelbox::decoder::decode_file(filename, &decoded))
       {
-        File w = LittleFS.open("/brightness", "w");
-        w.write("50");
-        w.close();
-        pixelbox::ws2812b_8x8::set_brightness_percent(50);
+        show_error();
         return;
       }
-      pixelbox::ws2812b_8x8::set_brightness_percent(f.readString().toInt());
-      f.close();
-    }
 
-    void load_max_current()
-    {
-      File f = LittleFS.open("/max_current", "r");
-      if(!f)
+      uint32_t peak_ma, avg_ma;
+      pixelbox::anim::estimate_current(&decoded, peak_ma, avg_ma);
+      pixelbox::catalog::set_current_estimate(filename, peak_ma, avg_ma);
+
+      //store it in the cache, it will be displayed from there
+      cached = pixelbox::image_cache::put(filename, entry->stamp, &decoded);
+      if(cached == NULL)
       {
-        File w = LittleFS.open("/max_current", "w");
-        w.write("1500");
-        w.close();
-        pixelbox::ws2812b_8x8::set_max_current(1500);
+        pixelbox::anim::animation_init(&decoded);
+        show_error();
         return;
       }
-      pixelbox::ws2812b_8x8::set_max_current(f.readString().toInt());
-      f.close();
+      display(cached);
     }
 
     void setup()
     {
-      //on startup set the connecting image if no image is uploaded/storage is empty
-      pixelbox::ws2812b_8x8::set(connecting_image);
+      //on startup play the connecting animation if no image is uploaded/storage is empty
+      if(!show_asset("connecting")) pixelbox::ws2812b_8x8::set_color(CRGB::Black);
       image_updated();
-      load_max_current();
-      load_brightness();
+      pixelbox::ws2812b_8x8::set_max_current(pixelbox::settings::get().max_current);
+      pixelbox::ws2812b_8x8::set_brightness_percent(pixelbox::settings::get().brightness);
     }
   }  
 }
@@ -0,0 +1,427 @@
+#include "store.hpp"
+
+#include <LittleFS.h>
+
+#include "fs_usage.hpp"
+#ifdef PIXELBOX_PACKED_STORE
+#include "pack.hpp"
+#endif
+
+namespace pixelbox
+{
+  namespace store
+  {
+    ref_s* refs_list = NULL;     //sorted by name, the manifest is written in this order
+    uint32_t refs_size = 0;
+    uint32_t refs_allocated = 0;
+    uint32_t manifest_size = 0;  //for the filesystem usage counters
+
+    String blob_path(const char* hash)
+    {
+      return String(STORE_BLOB_DIR) + "/" + hash;
+    }
+
+    uint32_t count()
+    {
+      return refs_size;
+    }
+
+    const ref_s* at(uint32_t index)
+    {
+      if(index >= refs_size) return NULL;
+      return &refs_list[index];
+    }
+
+    //binary search, returns the index of the reference or the insert position if not found
+    uint32_t lower_bound(const char* name, bool& found)
+    {
+      uint32_t lo = 0, hi = refs_size;
+      while(lo < hi)
+      {
+        uint32_t mid = (lo + hi) / 2;
+        if(strcmp(refs_list[mid].name, name) < 0) lo = mid + 1;
+        else hi = mid;
+      }
+      found = lo < refs_size && strcmp(refs_list[lo].name, name) == 0;
+      return lo;
+    }
+
+    int32_t find(const char* name)
+    {
+      bool found;
+      uint32_t index = lower_bound(name, found);
+      return found ? index : -1;
+    }
+
+    const char* hash(const String& name)
+    {
+      int32_t index = find(name.c_str());
+      if(index < 0) return NULL;
+      return refs_list[index].hash;
+    }
+
+    uint32_t refs(const char* hash)
+    {
+      //the reference count is derived from the names, it can't get out of sync with them
+      uint32_t n = 0;
+      for(uint32_t i = 0; i < refs_size; i++)
+        if(strcmp(refs_list[i].hash, hash) == 0) n++;
+      return n;
+    }
+
+    bool content_exists(const char* hash)
+    {
+#ifdef PIXELBOX_PACKED_STORE
+      if(pack::contains(hash)) return true;
+#endif
+      return LittleFS.exists(blob_path(hash)); //with the packed store: a blob the migration couldn't fit into the pack
+    }
+
+    void content_remove(const char* hash)
+    {
+#ifdef PIXELBOX_PACKED_STORE
+      if(pack::remove(hash)) return;
+#endif
+      File f = LittleFS.open(blob_path(hash), "r");
+      if(!f) return;
+      uint32_t size = f.size();
+      f.close();
+      if(LittleFS.remove(blob_path(hash))) fs_usage::resized(size, 0);
+    }
+
+    bool import_file(const String& file_path, const char* hash)
+    {
+      //move a complete file into the store, it's dropped if the content is already there
+#ifdef PIXELBOX_PACKED_STORE
+      //the source is removed only once the content is in the pack, without room for a copy (a full filesystem)
+      //it becomes or stays a blob file, read from there and moved into the pack by a later boot
+      if(pack::contains(hash) || pack::append(file_path, hash))
+      {
+        LittleFS.remove(file_path);
+        return true;
+      }
+#endif
+      String blob = blob_path(hash);
+      if(file_path == blob) return false;
+      if(LittleFS.exists(blob)) return LittleFS.remove(file_path);
+      LittleFS.mkdir(STORE_BLOB_DIR); //LittleFS drops empty directories
+      return LittleFS.rename(file_path, blob);
+    }
+
+    bool open(const String& name, reader_s& reader)
+    {
+      const char* h = hash(name);
+      if(h == NULL) return false;
+      reader.position = 0;
+      reader.in_pack = false;
+#ifdef PIXELBOX_PACKED_STORE
+      reader.in_pack = pack::open(h, reader.file, reader.offset, reader.size);
+      if(reader.in_pack) return true;
+#endif
+      reader.file = LittleFS.open(blob_path(h), "r");
+      if(!reader.file) return false;
+      reader.offset = 0;
+      reader.size = reader.file.size();
+      return true;
+    }
+
+    uint32_t read(reader_s& reader, uint8_t* buffer, uint32_t len)
+    {
+      if(!reader.file) return 0;
+      if(len > reader.size - reader.position) len = reader.size - reader.position;
+      int read_len = reader.file.read(buffer, len);
+      if(read_len <= 0) return 0;
+      reader.position += read_len;
+      return read_len;
+    }
+
+    bool seek(reader_s& reader, uint32_t position)
+    {
+      if(!reader.file || position > reader.size || !reader.file.seek(reader.offset + position)) return false;
+      reader.position = position;
+      return true;
+    }
+
+    void close(reader_s& reader)
+    {
+#ifdef PIXELBOX_PACKED_STORE
+      if(reader.in_pack)
+      {
+        pack::close(reader.file);
+        return;
+      }
+#endif
+      if(reader.file) reader.file.close();
+    }
+
+    bool save()
+    {
+      //written aside and renamed, a reset while writing leaves the previous manifest intact
+      File f = LittleFS.open(STORE_MANIFEST_TEMP, "w");
+      if(!f) return false;
+      bool ok = true;
+      uint32_t size = 0;
+      char line[CATALOG_NAME_MAX + CONTENT_HASH_HEX_SIZE + 2];
+      for(uint32_t i = 0; i < refs_size && ok; i++)
+      {
+        int len = snprintf(line, sizeof(line), "%s=%s\n", refs_list[i].name, refs_list[i].hash);
+        ok = f.write((const uint8_t*)line, len) == (size_t)len;
+        size += len;
+      }
+      f.close();
+      fs_usage::resized(0, size);
+      if(ok) ok = LittleFS.rename(STORE_MANIFEST_TEMP, STORE_MANIFEST);
+      if(!ok)
+      {
+        LittleFS.remove(STORE_MANIFEST_TEMP);
+        fs_usage::resized(size, 0);
+        return false;
+      }
+      fs_usage::resized(manifest_size, 0);
+      manifest_size = size;
+      return true;
+    }
+
+    void release(const char* hash)
+    {
+      //called after the manifest is saved, a reset in between only leaves an unreferenced content, deleted on boot
+      if(refs(hash) == 0) content_remove(hash);
+    }
+
+    bool set_ref(const char* name, const char* hash, char old_hash[CONTENT_HASH_HEX_SIZE])
+    {
+      old_hash[0] = '\0';
+      bool found;
+      uint32_t index = lower_bound(name, found);
+      if(found)
+      {
+        strcpy(old_hash, refs_list[index].hash);
+        strcpy(refs_list[index].hash, hash);
+        return true;
+      }
+
+      //grow the array if necessary
+      if(refs_size == refs_allocated)
+      {
+        ref_s* new_refs = (ref_s*)realloc(refs_list, (refs_allocated + STORE_ALLOCATION_SIZE) * sizeof(ref_s));
+        if(new_refs == NULL) return false;
+        refs_list = new_refs;
+        refs_allocated += STORE_ALLOCATION_SIZE;
+      }
+
+      //keep the array sorted
+      memmove(&refs_list[index + 1], &refs_list[index], (refs_size - index) * sizeof(ref_s));
+      strcpy(refs_list[index].name, name);
+      strcpy(refs_list[index].hash, hash);
+      refs_size++;
+      return true;
+    }
+
+    bool link(const String& name, const char* hash, bool save_manifest)
+    {
+      if(name.length() == 0 || name.length() >= CATALOG_NAME_MAX) return false;
+
+      char old_hash[CONTENT_HASH_HEX_SIZE];
+      if(!set_ref(name.c_str(), hash, old_hash)) return false;
+      if(strcmp(old_hash, hash) == 0) return true; //same content uploaded again, nothing changed
+      if(!save_manifest && old_hash[0] == '\0') return true; //a new name, nothing to release before the batch is saved
+
+      bool ok = save();
+      if(old_hash[0] != '\0') release(old_hash);
+      return ok;
+    }
+
+    bool commit(file_writer::writer_s& writer, const String& name, file_writer::stats_s& stats, bool save_manifest)
+    {
+      if(!file_writer::finish(writer, &stats)) return false;
+
+      if(content_exists(stats.hash)) file_writer::discard(writer); //a duplicate, only the reference is added
+      else
+      {
+#ifdef PIXELBOX_PACKED_STORE
+        //appended to the pack as a whole, a reset while receiving never leaves a partial record behind
+        bool ok = pack::append(writer.temp_path, stats.hash);
+        file_writer::discard(writer);
+        if(!ok) return false;
+#else
+        LittleFS.mkdir(STORE_BLOB_DIR); //LittleFS drops empty directories
+        writer.path = blob_path(stats.hash);
+        if(!file_writer::commit(writer)) return false;
+#endif
+      }
+      return link(name, stats.hash, save_manifest);
+    }
+
+    bool remove(const String& name)
+    {
+      int32_t index = find(name.c_str());
+      if(index < 0) return false;
+
+      char removed_hash[CONTENT_HASH_HEX_SIZE];
+      strcpy(removed_hash, refs_list[index].hash);
+      memmove(&refs_list[index], &refs_list[index + 1], (refs_size - index - 1) * sizeof(ref_s));
+      refs_size--;
+
+      bool ok = save();
+      release(removed_hash);
+      return ok;
+    }
+
+    bool valid_hash(const String& hash)
+    {
+      if(hash.length() != CONTENT_HASH_HEX_SIZE - 1) return false;
+      for(uint32_t i = 0; i < hash.length(); i++)
+        if(!isxdigit(hash[i])) return false;
+      return true;
+    }
+
+    bool load(bool& changed)
+    {
+      File f = LittleFS.open(STORE_MANIFEST, "r");
+      if(!f) return false;
+      manifest_size = f.size();
+      while(f.available())
+      {
+        String line = f.readStringUntil('\n');
+        int separator = line.lastIndexOf('=');
+        if(separator <= 0) continue;
+        String name = line.substring(0, separator);
+        String hash = line.substring(separator + 1);
+        if(name.length() >= CATALOG_NAME_MAX || !valid_hash(hash)) continue;
+
+        //a reference to a missing content would be an image that can't be opened
+        if(!content_exists(hash.c_str()))
+        {
+          changed = true;
+          continue;
+        }
+        char old_hash[CONTENT_HASH_HEX_SIZE];
+        set_ref(name.c_str(), hash.c_str(), old_hash);
+      }
+      f.close();
+      return true;
+    }
+
+    void unset_ref(const char* name, const char* old_hash)
+    {
+      //undo set_ref(): back to the previous content, or no reference at all
+      char replaced_hash[CONTENT_HASH_HEX_SIZE];
+      if(old_hash[0] != '\0')
+      {
+        set_ref(name, old_hash, replaced_hash);
+        return;
+      }
+      int32_t index = find(name);
+      if(index < 0) return;
+      memmove(&refs_list[index], &refs_list[index + 1], (refs_size - index - 1) * sizeof(ref_s));
+      refs_size--;
+    }
+
+    bool migrate_plain_file(uint32_t& skipped)
+    {
+      //move one plain image file into the store, false if there is none left
+      //a file that can't be hashed or imported is the user's only copy: it stays in place and is skipped until the next boot
+      Dir dir = LittleFS.openDir(CATALOG_DIR);
+      uint32_t skip = skipped;
+      while(dir.next())
+      {
+        if(!dir.isFile()) continue;
+        if(skip > 0)
+        {
+          skip--;
+          continue;
+        }
+        String name = dir.fileName();
+        String file_path = String(CATALOG_DIR) + "/" + name;
+
+        //the reference is saved before the content moves: a reset in between leaves a reference to a missing content
+        //(dropped by the next boot, which migrates the plain file again), never a moved content without reference (deleted on boot)
+        char hash[CONTENT_HASH_HEX_SIZE];
+        char old_hash[CONTENT_HASH_HEX_SIZE];
+        if(name.length() >= CATALOG_NAME_MAX || !content_hash::file(file_path, hash) || !set_ref(name.c_str(), hash, old_hash)) //a plain file is newer than the manifest entry of the same name
+        {
+          skipped++;
+          return true;
+        }
+        if(!save() || !import_file(file_path, hash))
+        {
+          unset_ref(name.c_str(), old_hash);
+          skipped++;
+        }
+        return true;
+      }
+      return false;
+    }
+
+#ifdef PIXELBOX_PACKED_STORE
+    bool migrate_blob()
+    {
+      //contents stored as separate files by the plain backend go into the pack
+      Dir dir = LittleFS.openDir(STORE_BLOB_DIR);
+      while(dir.next())
+      {
+        if(!dir.isFile()) continue;
+        String file_path = String(STORE_BLOB_DIR) + "/" + dir.fileName();
+        if(!valid_hash(dir.fileName()))
+        {
+          LittleFS.remove(file_path); //not a content of ours
+          return true;
+        }
+        //a full pack stops the migration, the remaining blobs stay and are read as files
+        return import_file(file_path, dir.fileName().c_str());
+      }
+      return false;
+    }
+
+    bool remove_unreferenced_packed()
+    {
+      for(uint32_t i = 0; i < pack::count(); i++)
+      {
+        if(refs(pack::at(i)->hash) > 0) continue;
+        pack::remove(pack::at(i)->hash);
+        return true;
+      }
+      return false;
+    }
+#endif
+
+    bool remove_unreferenced_blob()
+    {
+#ifdef PIXELBOX_PACKED_STORE
+      if(remove_unreferenced_packed()) return true;
+#endif
+      Dir dir = LittleFS.openDir(STORE_BLOB_DIR);
+      while(dir.next())
+      {
+        if(!dir.isFile() || refs(dir.fileName().c_str()) > 0) continue;
+        LittleFS.remove(String(STORE_BLOB_DIR) + "/" + dir.fileName());
+        return true;
+      }
+      return false;
+    }
+
+    void setup()
+    {
+#ifdef PIXELBOX_PACKED_STORE
+      pack::setup();
+      while(migrate_blob());
+#endif
+      bool changed = false;
+      if(!load(changed)) changed = true;
+
+      //don't change a directory while iterating it, start over after each change
+      uint32_t skipped = 0;
+      while(migrate_plain_file(skipped)) changed = true;
+      while(remove_unreferenced_blob());
+
+      if(changed) save();
+    }
+
+    void loop()
+    {
+#ifdef PIXELBOX_PACKED_STORE
+      pack::loop();
+#endif
+    }
+  }
+}
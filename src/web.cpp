@@ -4,6 +4,22 @@
 #include <LittleFS.h>
 
 #include "ws2812b_8x8.hpp"
+#include "settings.hpp"
+#include "catalog.hpp"
+#include "image_cache.hpp"
+#include "file_writer.hpp"
+#include "store.hpp"
+#include "fs_usage.hpp"
+#include "assets.hpp"
+#ifdef PIXELBOX_PACKED_STORE
+#include "pack.hpp"
+#endif
+#include "decoder.hpp"
+#include "alloc.hpp"
+#include "gui_data.hpp"
+#include "events.hpp"
+#include "mirror.hpp"
+#include "realtime.hpp"
 
 namespace pixelbox
 {
@@ -14,55 +30,27 @@ namespace pixelbox
 
     bool set_displayed_image(String name)
     {
-      File di = LittleFS.open("/displayed_image", "w");
-      if(!di) return false;
-      if(di.write(name.c_str()) != name.length()) return false;
-      di.close();
+      pixelbox::settings::set_displayed_image(name);
       if(updated_cb) updated_cb();
       return true;
     }
 
     bool get_displayed_image(String& filename)
     {
-      File di = LittleFS.open("/displayed_image", "r");
-      if(!di) return false;
-      filename = di.readString();
-      di.close();
+      filename = pixelbox::settings::get().displayed_image;
       return true;
     }
 
     void select_next_image(String name)
     {
-      Dir dir = LittleFS.openDir("/images");
-      uint32_t file_count = 0;
-      while (dir.next()) file_count++;
-
-      if(file_count == 0 || file_count == 1)
+      if(pixelbox::catalog::count() == 0 || pixelbox::catalog::count() == 1)
       {
         set_displayed_image("");
         return;
       }
 
-      dir.rewind();
-      while (dir.next())
-      {
-        //if found the file, get the next
-        if(dir.fileName() == name)
-        {
-          if(dir.next()) //the displayed was not the last file, we can select the next one
-          {
-            set_displayed_image(dir.fileName());
-            return;
-          }
-          else //the displayed is the last file, we have to go back to the first one
-          {
-            dir.rewind();
-            dir.next();
-            set_displayed_image(dir.fileName());
-            return;
-          }
-        }
-      }
+      //the catalog is sorted and wraps around after the last image
+      set_displayed_image(pixelbox::catalog::next(name)->name);
     }
 
     bool del_image(String name)
@@ -73,46 +61,505 @@ namespace pixelbox
       //if we want to delete the displayed image, we will set the next one as displayed
       if(name == displayed_image) select_next_image(displayed_image);
 
-      return LittleFS.remove("/images/" + name);
+      if(!pixelbox::store::remove(name)) return false;
+      pixelbox::catalog::remove(name);
+      pixelbox::image_cache::remove(name);
+      return true;
     }
 
-    void image_upload_req(AsyncWebServerRequest* request)
+    typedef enum archive_state_e
     {
-      request->send(200);      
-    }    
+      archive_state_name_len = 0,  //u8 length of the file name
+      archive_state_name = 1,      //file name, not terminated
+      archive_state_size = 2,      //u32 little endian file size
+      archive_state_data = 3,      //file content
+    } archive_state_e;
 
-    void image_upload(AsyncWebServerRequest * request, String filename, size_t index, uint8_t *data, size_t len, bool final)
+    typedef struct archive_s      //parsing state of a batch upload
     {
-      if(index == 0)
+      archive_state_e state;
+      uint8_t name_len;
+      char field[CATALOG_NAME_MAX]; //name or size being received
+      uint32_t field_size;
+      String name;
+      uint32_t remaining;         //bytes left of the current file
+      uint32_t files;             //images stored
+      String names;               //images stored, one per line, added to the catalog and the manifest at once
+      String first;               //displayed at the end
+      pixelbox::anim::animation_s first_anim; //the first image decoded while received (the others are not), cached at the end
+      uint32_t size;
+      uint32_t flash_ms;
+      uint32_t start_ms;
+    } archive_s;
+
+    typedef struct upload_s     //one upload in progress
+    {
+      AsyncWebServerRequest* request; //NULL if the slot is free
+      String name;
+      archive_s archive;        //only used by batch uploads
+      pixelbox::file_writer::writer_s writer;
+      pixelbox::decoder::stream_s stream; //the image is decoded while received
+      int status;               //response code, 0 while the upload is going on
+      String message;           //response body
+    } upload_s;
+
+    upload_s uploads[UPLOAD_MAX_ACTIVE];
+
+    void archive_flush(upload_s* upload)
+    {
+      //one manifest write and one catalog change for the whole batch, also for the images stored before an error or a disconnect
+      archive_s& archive = upload->archive;
+      if(archive.names.length() > 0)
       {
-        request->_tempFile = LittleFS.open("/images/" + filename, "w");
-        if(!request->_tempFile)
+        pixelbox::store::save();
+        pixelbox::catalog::update_all(archive.names);
+        archive.names = String();
+
+        int32_t index = pixelbox::catalog::find(archive.first);
+        if(archive.first_anim.frames_size > 0 && index >= 0)
         {
-          request->send(500, "plain/text", "Failed to open file.");
-          return;
+          uint32_t peak_ma, avg_ma;
+          pixelbox::anim::estimate_current(&archive.first_anim, peak_ma, avg_ma);
+          pixelbox::catalog::set_current_estimate(archive.first, peak_ma, avg_ma);
+          pixelbox::image_cache::put(archive.first, pixelbox::catalog::at(index)->stamp, &archive.first_anim);
         }
       }
+      pixelbox::anim::animation_init(&archive.first_anim);
+    }
+
+    upload_s* upload_find(AsyncWebServerRequest* request)
+    {
+      for(uint32_t i = 0; i < UPLOAD_MAX_ACTIVE; i++)
+        if(uploads[i].request == request) return &uploads[i];
+      return NULL;
+    }
+
+    void upload_release(upload_s* upload)
+    {
+      archive_flush(upload); //a batch upload cut off by a disconnect
+      pixelbox::file_writer::abort(upload->writer);
+      pixelbox::decoder::stream_cancel(upload->stream);
+      upload->request = NULL;
+      upload->name = String();
+      upload->message = String();
+      upload->status = 0;
+      upload->archive = archive_s();
+    }
+
+    void upload_fail(upload_s* upload, int status, const String& message)
+    {
+      //the final file is untouched, only the temp file is dropped, the response is sent when the request is complete
+      pixelbox::file_writer::abort(upload->writer);
+      pixelbox::decoder::stream_cancel(upload->stream);
+      upload->status = status;
+      upload->message = message;
+    }
+
+    void upload_reject(AsyncWebServerRequest* request, const char* message)
+    {
+      //no upload slot to keep the error in, the request keeps it (freed by the server together with the request)
+      if(request->_tempObject == NULL) request->_tempObject = strdup(message);
+    }
+
+    const char* check_name(const String& name)
+    {
+      if(name.length() == 0 || name.length() >= CATALOG_NAME_MAX || name.indexOf('/') >= 0) return "Invalid file name.";
+      //the manifest and the archive's name list are line based
+      for(uint32_t i = 0; i < name.length(); i++)
+        if((uint8_t)name[i] < 0x20 || name[i] == 0x7F) return "Invalid file name.";
+      if(pixelbox::catalog::format_of(name) == pixelbox::catalog::format_unknown) return "Unsupported file type.";
+      return NULL;
+    }
+
+    upload_s* upload_claim(AsyncWebServerRequest* request)
+    {
+      upload_s* upload = upload_find(NULL);
+      if(upload == NULL)
+      {
+        upload_reject(request, "Too many uploads.");
+        return NULL;
+      }
+      upload->request = request;
+      upload->status = 0;
+      request->onDisconnect([request]()
+      {
+        upload_s* upload = upload_find(request);
+        if(upload) upload_release(upload);
+      });
+      return upload;
+    }
+
+    bool upload_open(upload_s* upload, const String& name, uint32_t expected_size, bool decode = true)
+    {
+      upload->name = name;
+      //the final path is the content hash, known once everything is received
+      if(!pixelbox::file_writer::begin(upload->writer, String(), expected_size))
+      {
+        upload_fail(upload, expected_size > pixelbox::fs_usage::free_space() ? 507 : 500, "Failed to open file.");
+        return false;
+      }
+      //an image that isn't decoded while received (not displayed, too big for the heap) gets at least its header and size checked
+      pixelbox::catalog::format_e format = pixelbox::catalog::format_of(name);
+      if(!decode || !pixelbox::decoder::stream_begin(upload->stream, format, expected_size)) pixelbox::decoder::stream_begin(upload->stream, format, expected_size, true);
+      return true;
+    }
+
+    upload_s* upload_begin(AsyncWebServerRequest* request, const String& name, uint32_t expected_size)
+    {
+      const char* error = check_name(name);
+      if(error)
+      {
+        upload_reject(request, error);
+        return NULL;
+      }
+
+      upload_s* upload = upload_claim(request);
+      if(upload) upload_open(upload, name, expected_size);
+      return upload;
+    }
+
+    bool upload_write(upload_s* upload, const uint8_t* data, size_t len)
+    {
+      if(upload->status != 0) return false; //failed already, the rest is dropped
+      if(!pixelbox::file_writer::write(upload->writer, data, len))
+      {
+        upload_fail(upload, 500, "Write error.");
+        return false;
+      }
+      if(!pixelbox::decoder::stream_feed(upload->stream, data, len))
+      {
+        upload_fail(upload, 400, "Invalid image.");
+        return false;
+      }
+      return true;
+    }
+
+    bool upload_store(upload_s* upload, pixelbox::file_writer::stats_s& stats, bool batch = false)
+    {
+      //a truncated image is not stored, the previous version (if any) stays
+      if(upload->stream.active && !upload->stream.done)
+      {
+        upload_fail(upload, 400, "Invalid image.");
+        return false;
+      }
+
+      if(!pixelbox::store::commit(upload->writer, upload->name, stats, !batch))
+      {
+        upload_fail(upload, 500, "Write error.");
+        return false;
+      }
+      if(batch) return true; //the catalog and the manifest are updated by archive_flush()
+      pixelbox::catalog::update(upload->name);
+      pixelbox::image_cache::remove(upload->name);
+
+      //the image decoded during the upload goes right into the cache, displaying it needs no flash read
+      int32_t index = pixelbox::catalog::find(upload->name);
+      if(upload->stream.done && index >= 0)
+      {
+        uint32_t peak_ma, avg_ma;
+        pixelbox::anim::estimate_current(&upload->stream.anim, peak_ma, avg_ma);
+        pixelbox::catalog::set_current_estimate(upload->name, peak_ma, avg_ma);
+        pixelbox::image_cache::put(upload->name, pixelbox::catalog::at(index)->stamp, &upload->stream.anim);
+      }
+      pixelbox::decoder::stream_cancel(upload->stream);
+      return true;
+    }
+
+    bool upload_finish(upload_s* upload)
+    {
+      if(upload->status != 0) return false;
+
+      pixelbox::file_writer::stats_s stats;
+      if(!upload_store(upload, stats)) return false;
 
-      request->_tempFile.seek(index);
-      size_t written = request->_tempFile.write(data, len);
-      if(written != len)
+      if(!set_displayed_image(upload->name))
       {
-        request->send(500, "plain/text", "Write error.");
+        upload_fail(upload, 500, "Set error.");
+        return false;
+      }
+
+      //throughput of the whole upload and of the flash writes alone
+      upload->status = 200;
+      upload->message = "{\"size\":" + String(stats.size) + ", \"total_ms\":" + String(stats.total_ms) + ", \"flash_ms\":" + String(stats.flash_ms);
+      upload->message += ", \"total_kbps\":" + String(stats.total_ms ? stats.size / stats.total_ms : 0) + ", \"flash_kbps\":" + String(stats.flash_ms ? stats.size / stats.flash_ms : 0) + "}";
+      return true;
+    }
+
+    void upload_response(AsyncWebServerRequest* request)
+    {
+      upload_s* upload = upload_find(request);
+      if(upload == NULL)
+      {
+        if(request->_tempObject) request->send(400, "plain/text", (const char*)request->_tempObject);
+        else request->send(400, "plain/text", "No file uploaded.");
         return;
       }
 
-      if (final)
+      if(upload->status == 0) request->send(500, "plain/text", "Upload incomplete.");
+      else if(upload->status == 200) request->send(200, "text/json", upload->message);
+      else request->send(upload->status, "plain/text", upload->message);
+      upload_release(upload);
+    }
+
+    void image_upload_req(AsyncWebServerRequest* request)
+    {
+      upload_response(request);
+    }
+
+    void image_upload(AsyncWebServerRequest * request, String filename, size_t index, uint8_t *data, size_t len, bool final)
+    {
+      upload_s* upload = index == 0 ? upload_begin(request, filename, request->contentLength()) : upload_find(request);
+      if(upload == NULL) return;
+      if(!upload_write(upload, data, len)) return;
+      if(final) upload_finish(upload);
+    }
+
+    void image_put_req(AsyncWebServerRequest* request)
+    {
+      upload_response(request);
+    }
+
+    void image_put(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)
+    {
+      //raw body, no multipart parsing: the file name is in the URL (already decoded by the server), the size is the Content-Length
+      upload_s* upload = NULL;
+      if(index == 0) upload = upload_begin(request, request->url().substring(strlen("/image/")), total);
+      else upload = upload_find(request);
+      if(upload == NULL) return;
+      if(!upload_write(upload, data, len)) return;
+      if(index + len >= total) upload_finish(upload);
+    }
+
+    void archive_fail(upload_s* upload, int status, const String& message)
+    {
+      //the images stored before the error stay, the client learns how far it got
+      archive_flush(upload);
+      upload_fail(upload, status, message + " " + String(upload->archive.files) + " image(s) stored before the error.");
+    }
+
+    bool archive_field(upload_s* upload, const uint8_t*& data, size_t& len, uint32_t size)
+    {
+      //collect a header field that may be split over several chunks
+      while(len > 0 && upload->archive.field_size < size)
       {
-        request->_tempFile.close();
+        upload->archive.field[upload->archive.field_size++] = *data++;
+        len--;
+      }
+      return upload->archive.field_size == size;
+    }
 
-        if(!set_displayed_image(filename))
+    bool archive_write(upload_s* upload, const uint8_t* data, size_t len)
+    {
+      archive_s& archive = upload->archive;
+      while(len > 0 && upload->status == 0)
+      {
+        switch (archive.state)
         {
-          request->send(500, "plain/text", "Set error.");
-          return;
+        case archive_state_name_len:
+          archive.name_len = *data++;
+          len--;
+          if(archive.name_len == 0 || archive.name_len >= CATALOG_NAME_MAX)
+          {
+            archive_fail(upload, 400, "Invalid file name.");
+            return false;
+          }
+          archive.field_size = 0;
+          archive.state = archive_state_name;
+          break;
+        case archive_state_name:
+          if(!archive_field(upload, data, len, archive.name_len)) break;
+          archive.field[archive.name_len] = '\0';
+          archive.name = String(archive.field);
+          archive.field_size = 0;
+          archive.state = archive_state_size;
+          break;
+        case archive_state_size:
+        {
+          if(!archive_field(upload, data, len, 4)) break;
+          const uint8_t* size = (const uint8_t*)archive.field;
+          archive.remaining = size[0] | (size[1] << 8) | (size[2] << 16) | ((uint32_t)size[3] << 24);
+
+          const char* error = check_name(archive.name);
+          if(error)
+          {
+            archive_fail(upload, 400, String(error));
+            return false;
+          }
+          if(archive.remaining == 0)
+          {
+            archive_fail(upload, 400, "Empty file " + archive.name + ".");
+            return false;
+          }
+          if(!upload_open(upload, archive.name, archive.remaining, archive.files == 0)) //only the displayed image is decoded
+          {
+            archive_fail(upload, upload->status, upload->message);
+            return false;
+          }
+          archive.state = archive_state_data;
+          break;
         }
+        case archive_state_data:
+        {
+          size_t part = len < archive.remaining ? len : archive.remaining;
+          if(!upload_write(upload, data, part))
+          {
+            archive_fail(upload, upload->status, archive.name + ": " + upload->message);
+            return false;
+          }
+          data += part;
+          len -= part;
+          archive.remaining -= part;
+          if(archive.remaining > 0) break;
 
-        request->send(200);
+          pixelbox::file_writer::stats_s stats;
+          if(!upload_store(upload, stats, true))
+          {
+            archive_fail(upload, upload->status, upload->message);
+            return false;
+          }
+          pixelbox::image_cache::remove(upload->name);
+          if(archive.files == 0)
+          {
+            archive.first = upload->name;
+            archive.first_anim = upload->stream.anim; //taken over, cached by archive_flush()
+            memset(&upload->stream.anim, 0, sizeof(upload->stream.anim));
+          }
+          pixelbox::decoder::stream_cancel(upload->stream);
+          if(archive.names.length() > 0) archive.names += "\n";
+          archive.names += upload->name;
+          archive.files++;
+          archive.size += stats.size;
+          archive.flash_ms += stats.flash_ms;
+          archive.state = archive_state_name_len;
+          break;
+        }
+        }
+      }
+      return upload->status == 0;
+    }
+
+    bool archive_finish(upload_s* upload)
+    {
+      if(upload->status != 0) return false;
+      archive_s& archive = upload->archive;
+
+      //the archive must end between two images
+      if(archive.state != archive_state_name_len || archive.files == 0)
+      {
+        archive_fail(upload, 400, "Truncated archive.");
+        return false;
       }
+
+      //one catalog change and one display change for the whole batch, the first image of the archive is shown
+      archive_flush(upload);
+      if(!set_displayed_image(archive.first))
+      {
+        upload_fail(upload, 500, "Set error.");
+        return false;
+      }
+
+      uint32_t total_ms = millis() - archive.start_ms;
+      upload->status = 200;
+      upload->message = "{\"files\":" + String(archive.files) + ", \"size\":" + String(archive.size) + ", \"total_ms\":" + String(total_ms) + ", \"flash_ms\":" + String(archive.flash_ms);
+      upload->message += ", \"total_kbps\":" + String(total_ms ? archive.size / total_ms : 0) + ", \"flash_kbps\":" + String(archive.flash_ms ? archive.size / archive.flash_ms : 0) + "}";
+      return true;
+    }
+
+    void images_put_req(AsyncWebServerRequest* request)
+    {
+      upload_response(request);
+    }
+
+    void images_put(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)
+    {
+      //archive of many images in one raw body, written one after the other through the same writer buffer
+      upload_s* upload = NULL;
+      if(index == 0)
+      {
+        upload = upload_claim(request);
+        if(upload == NULL) return;
+        upload->archive = archive_s();
+        upload->archive.start_ms = millis();
+      }
+      else upload = upload_find(request);
+      if(upload == NULL) return;
+      if(!archive_write(upload, data, len)) return;
+      if(index + len >= total) archive_finish(upload);
+    }
+
+    typedef struct images_list_s  //state of one streamed /images response
+    {
+      uint32_t next;      //next catalog index to write
+      uint32_t end;       //one past the last catalog index of the page
+      bool meta;          //entries are objects with the catalog metadata instead of plain names
+      bool first;         //no separator before the first entry
+      bool closed;        //closing brackets written
+      char pending[IMAGES_LIST_LINE_SIZE];  //formatted text not fitting into the last TCP buffer
+      uint32_t pending_size;
+      uint32_t pending_offset;
+    } images_list_s;
+
+    void format_images_entry(images_list_s& list)
+    {
+      //format the next piece of the response into the pending buffer
+      int len;
+      const pixelbox::catalog::entry_s* entry = list.next < list.end ? pixelbox::catalog::at(list.next) : NULL;
+      if(entry == NULL) //end of the page (or the catalog shrank meanwhile)
+      {
+        len = snprintf(list.pending, sizeof(list.pending), "]}");
+        list.closed = true;
+      }
+      else if(!list.meta)
+        len = snprintf(list.pending, sizeof(list.pending), "%s\"%s\"", list.first ? "" : ",", entry->name);
+      else
+        len = snprintf(list.pending, sizeof(list.pending), "%s{\"name\":\"%s\",\"size\":%u,\"format\":\"%s\",\"width\":%u,\"height\":%u,\"frames\":%u,\"peak_ma\":%u,\"avg_ma\":%u}",
+                       list.first ? "" : ",", entry->name, entry->size, pixelbox::catalog::format_name(entry->format),
+                       entry->width, entry->height, entry->frames, entry->peak_ma, entry->avg_ma);
+      list.next++;
+      list.first = false;
+      list.pending_offset = 0;
+      if(len < 0) len = 0;
+      if(len >= (int)sizeof(list.pending)) len = sizeof(list.pending) - 1; //truncated, shouldn't happen with CATALOG_NAME_MAX names
+      list.pending_size = len;
+    }
+
+    void images_list(AsyncWebServerRequest* request)
+    {
+      //the listing is written straight into the TCP buffers entry by entry, memory use doesn't depend on the number of images
+      std::shared_ptr<images_list_s> list = std::make_shared<images_list_s>();
+      memset(list.get(), 0, sizeof(images_list_s));
+
+      uint32_t total = pixelbox::catalog::count();
+      uint32_t offset = request->hasArg("offset") ? request->arg("offset").toInt() : 0;
+      uint32_t limit = request->hasArg("limit") ? request->arg("limit").toInt() : 0; //0: everything after offset
+      if(offset > total) offset = total;
+      list->next = offset;
+      list->end = limit > 0 && limit < total - offset ? offset + limit : total;
+      list->meta = request->hasArg("meta") && request->arg("meta") != "0";
+      list->first = true;
+      list->pending_size = snprintf(list->pending, sizeof(list->pending), "{\"total\":%u,\"offset\":%u,\"images\":[", total, offset);
+
+      AsyncWebServerResponse* response = request->beginChunkedResponse("text/json", [list](uint8_t* buffer, size_t max_len, size_t index) -> size_t
+      {
+        size_t written = 0;
+        while(written < max_len)
+        {
+          if(list->pending_offset == list->pending_size)
+          {
+            if(list->closed) break;
+            format_images_entry(*list);
+            continue;
+          }
+          uint32_t len = list->pending_size - list->pending_offset;
+          if(len > max_len - written) len = max_len - written;
+          memcpy(buffer + written, list->pending + list->pending_offset, len);
+          list->pending_offset += len;
+          written += len;
+        }
+        return written; //0 ends the response
+      });
+      response->addHeader("Cache-Control", "no-cache");
+      request->send(response);
     }
 
     void add_route(const char* route, routeCallbackFunction callback)
@@ -125,55 +572,78 @@ namespace pixelbox
       updated_cb = callback;
     }
 
-    String processor(const String& var)
+    bool not_modified(AsyncWebServerRequest* request, const char* hash)
     {
-      fs::FSInfo info;
-      LittleFS.info(info);
-      if(var == "TOTAL_SIZE")
-        return String(info.totalBytes / 1024);
-      else if(var == "ALLOCATED_SIZE")
-        return String(info.usedBytes / 1024);
-      else if(var == "FREE_HEAP")
-        return String(ESP.getFreeHeap());
-      else if(var == "BRIGHTNESS")
-      {
-        File f = LittleFS.open("/brightness", "r");
-        if(!f) return "";
-        String ret = f.readString();
-        f.close();
-        return ret;
-      }
-      else if(var == "MAX_CURRENT")
+      //ETags are the quoted content hashes, a matching If-None-Match means the client's copy is still valid
+      if(hash == NULL || hash[0] == '\0' || !request->hasHeader("If-None-Match")) return false;
+      String etag = "\"" + String(hash) + "\"";
+      if(request->header("If-None-Match") != etag) return false;
+
+      AsyncWebServerResponse *response = request->beginResponse(304);
+      response->addHeader("ETag", etag);
+      request->send(response);
+      return true;
+    }
+
+    void send_asset(AsyncWebServerRequest* request, const char* content_type, const uint8_t* data, uint32_t size, const char* hash)
+    {
+      if(not_modified(request, hash)) return;
+
+      //compiled into the firmware gzipped, sent right from flash
+      AsyncWebServerResponse *response = request->beginResponse_P(200, content_type, data, size);
+      response->addHeader("Content-Encoding", "gzip");
+      response->addHeader("ETag", "\"" + String(hash) + "\"");
+
+      //index.html refers to the assets with their hash in the URL, such a URL never changes its content
+      if(request->hasArg("v") && request->arg("v") == hash) response->addHeader("Cache-Control", "public, max-age=31536000, immutable");
+      else response->addHeader("Cache-Control", "no-cache");
+      request->send(response);
+    }
+
+    String fs_status()
+    {
+      return "\"total_size\":" + String(pixelbox::fs_usage::total() / 1024) + ", \"allocated_size\":" + String(pixelbox::fs_usage::used() / 1024) + ", \"free_heap\":" + String(ESP.getFreeHeap());
+    }
+
+    void remove_old_gui_files()
+    {
+      //the GUI used to be uploaded to the filesystem, give that space back to the images
+      const char* paths[] = {"/index.html", "/main.js.gz", "/mvp.css.gz"};
+      for(uint32_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++)
       {
-        File f = LittleFS.open("/max_current", "r");
-        if(!f) return "";
-        String ret = f.readString();
-        f.close();
-        return ret;
+        File file = LittleFS.open(paths[i], "r");
+        if(!file) continue;
+        uint32_t size = file.size();
+        file.close();
+        if(LittleFS.remove(paths[i])) pixelbox::fs_usage::resized(size, 0);
       }
-      else
-        return String();
     }
 
     void setup()
     {
       LittleFS.begin();
+      remove_old_gui_files();
 
       server.on("/", HTTP_GET, [](AsyncWebServerRequest* request)
       {
-        request->send(LittleFS, "/index.html", String(), false, processor);
+        send_asset(request, "text/html", pixelbox::gui_data::index_html_gz, pixelbox::gui_data::index_html_gz_size, pixelbox::gui_data::index_html_hash);
       });
       server.on("/main.js", HTTP_GET, [](AsyncWebServerRequest* request)
       {
-        AsyncWebServerResponse *response = request->beginResponse(LittleFS, "/main.js.gz", "text/javascript", false, nullptr);
-        response->addHeader("Content-Encoding", "gzip");
-        request->send(response);
+        send_asset(request, "text/javascript", pixelbox::gui_data::main_js_gz, pixelbox::gui_data::main_js_gz_size, pixelbox::gui_data::main_js_hash);
       });
       server.on("/mvp.css", HTTP_GET, [](AsyncWebServerRequest* request)
       {
-        AsyncWebServerResponse *response = request->beginResponse(LittleFS, "/mvp.css.gz", "text/css", false, nullptr);
-        response->addHeader("Content-Encoding", "gzip");
-        request->send(response);
+        send_asset(request, "text/css", pixelbox::gui_data::mvp_css_gz, pixelbox::gui_data::mvp_css_gz_size, pixelbox::gui_data::mvp_css_hash);
+      });
+      server.on("/gui_config", HTTP_GET, [](AsyncWebServerRequest* request)
+      {
+        //values the page used to get from the template processor
+        String output;
+        output += "{\"width\":" + String(WS_LED_WIDTH) + ", \"height\":" + String(WS_LED_HEIGHT);
+        output += ", \"brightness\":" + String(pixelbox::settings::get().brightness) + ", \"max_current\":" + String(pixelbox::settings::get().max_current);
+        output += ", " + fs_status() + "}";
+        request->send(200, "text/json", output);
       });
       server.on("/displayed_image", HTTP_GET, [](AsyncWebServerRequest* request)
       {
@@ -185,12 +655,31 @@ namespace pixelbox
           return;
         }
 
+        //the GUI revalidates the displayed image, it's only sent again if it has changed
+        const char* hash = pixelbox::catalog::hash(filename);
+        if(not_modified(request, hash)) return;
+
         String content_type = "unkown";
         if(filename.endsWith(".png")) content_type = "image/png";
         else if(filename.endsWith(".gif")) content_type = "image/gif";
 
-        AsyncWebServerResponse *response = request->beginResponse(LittleFS, "/images/" + filename, content_type, false, nullptr);
+        //the content may be a range of the pack, it's read through the store
+        std::shared_ptr<pixelbox::store::reader_s> reader(new pixelbox::store::reader_s(), [](pixelbox::store::reader_s* reader)
+        {
+          pixelbox::store::close(*reader);
+          delete reader;
+        });
+        if(!pixelbox::store::open(filename, *reader))
+        {
+          request->send(404, "plain/text", "Image not found.");
+          return;
+        }
+        AsyncWebServerResponse *response = request->beginResponse(content_type, reader->size, [reader](uint8_t* buffer, size_t max_len, size_t index) -> size_t
+        {
+          return pixelbox::store::read(*reader, buffer, max_len);
+        });
         response->addHeader("Cache-Control", "no-cache");
+        if(hash) response->addHeader("ETag", "\"" + String(hash) + "\"");
         request->send(response);
       });
       server.on("/displayed_image", HTTP_POST, [](AsyncWebServerRequest* request)
@@ -204,6 +693,8 @@ namespace pixelbox
         request->send(200);
       });
       server.on("/image", HTTP_POST, image_upload_req, image_upload);
+      server.on("/image/*", HTTP_PUT, image_put_req, NULL, image_put);
+      server.on("/images", HTTP_PUT, images_put_req, NULL, images_put);
       server.on("/image", HTTP_DELETE, [](AsyncWebServerRequest* request)
       {
         String filename = request->arg("image");
@@ -214,63 +705,92 @@ namespace pixelbox
         }
         request->send(200);
       });
-      server.on("/images", HTTP_GET, [](AsyncWebServerRequest* request)
+      server.on("/images", HTTP_GET, images_list);
+      server.on("/fs_status", HTTP_GET, [](AsyncWebServerRequest* request)
       {
         String output;
-        output += "{\"images\": [";
-
-        Dir dir = LittleFS.openDir("/images");
-        bool first = true;
-        while (dir.next())
+        output += "{" + fs_status() + "}";
+        request->send(200, "text/json", output);
+      });
+      server.on("/decode_heap", HTTP_GET, [](AsyncWebServerRequest* request)
+      {
+        //heap cost of the last decode, next to what the heap can give right now
+        pixelbox::alloc::stats_s stats = pixelbox::alloc::last();
+        String output;
+        output += "{\"calls\":" + String(stats.calls) + ", \"bytes\":" + String(stats.bytes) + ", \"peak\":" + String(stats.peak) + ", \"largest\":" + String(stats.largest);
+        output += ", \"free_block\":" + String(stats.free_block) + ", \"free_heap\":" + String(ESP.getFreeHeap()) + ", \"max_free_block\":" + String(ESP.getMaxFreeBlockSize()) + "}";
+        request->send(200, "text/json", output);
+      });
+      server.on("/image_cache", HTTP_GET, [](AsyncWebServerRequest* request)
+      {
+        pixelbox::image_cache::stats_s stats = pixelbox::image_cache::get_stats();
+        String output;
+        output += "{\"hits\":" + String(stats.hits) + ", \"misses\":" + String(stats.misses) + ", \"evictions\":" + String(stats.evictions);
+        output += ", \"entries\":" + String(stats.entries) + ", \"used_bytes\":" + String(stats.used_bytes) + ", \"budget\":" + String(pixelbox::image_cache::get_budget()) + "}";
+        request->send(200, "text/json", output);
+      });
+      server.on("/image_cache", HTTP_POST, [](AsyncWebServerRequest* request)
+      {
+        pixelbox::image_cache::set_budget(request->arg("budget").toInt());
+        request->send(200);
+      });
+#ifdef PIXELBOX_PACKED_STORE
+      server.on("/pack", HTTP_GET, [](AsyncWebServerRequest* request)
+      {
+        pixelbox::pack::stats_s stats = pixelbox::pack::get_stats();
+        String output;
+        output += "{\"file_size\":" + String(stats.file_size) + ", \"live_bytes\":" + String(stats.live_bytes) + ", \"dead_bytes\":" + String(stats.dead_bytes);
+        output += ", \"contents\":" + String(stats.contents) + ", \"compactions\":" + String(stats.compactions) + "}";
+        request->send(200, "text/json", output);
+      });
+#endif
+      server.on("/assets", HTTP_GET, [](AsyncWebServerRequest* request)
+      {
+        //built-in images and animations, displayable by name like the uploaded ones
+        const pixelbox::assets::region_s& region = pixelbox::assets::builtin();
+        String output = "[";
+        pixelbox::assets::asset_s asset;
+        for(uint32_t i = 0; i < region.count; i++)
         {
-          if(!first) output += ",";
-          else first = false;
-          output += "\"" + dir.fileName() + "\"";
+          if(!pixelbox::assets::get(region, i, asset)) continue;
+          if(output.length() > 1) output += ",";
+          output += "{\"name\":\"" + String(asset.name) + "\",\"width\":" + String(asset.width) + ",\"height\":" + String(asset.height) + ",\"frames\":" + String(asset.frames) + "}";
         }
-
-        output += "]}";
+        output += "]";
         request->send(200, "text/json", output);
       });
-      server.on("/fs_status", HTTP_GET, [](AsyncWebServerRequest* request)
+      server.on("/current_estimate", HTTP_GET, [](AsyncWebServerRequest* request)
       {
+        uint32_t peak_ma, avg_ma;
+        pixelbox::ws2812b_8x8::get_current_estimate(peak_ma, avg_ma);
         String output;
-        output += "{\"total_size\":" + processor("TOTAL_SIZE") + ", \"allocated_size\":" + processor("ALLOCATED_SIZE") + ", \"free_heap\":" + processor("FREE_HEAP") + "}";
+        output += "{\"peak_ma\":" + String(peak_ma) + ", \"avg_ma\":" + String(avg_ma) + "}";
+        request->send(200, "text/json", output);
+      });
+      server.on("/realtime", HTTP_GET, [](AsyncWebServerRequest* request)
+      {
+        pixelbox::realtime::stats_s stats = pixelbox::realtime::get_stats();
+        String output;
+        output += "{\"active\":" + String(stats.active ? "true" : "false") + ", \"fps\":" + String(stats.fps) + ", \"packets\":" + String(stats.ddp.packets);
+        output += ", \"frames\":" + String(stats.ddp.frames) + ", \"shown\":" + String(stats.shown) + ", \"dropped\":" + String(stats.dropped);
+        output += ", \"lost\":" + String(stats.ddp.lost) + ", \"invalid\":" + String(stats.ddp.invalid) + "}";
         request->send(200, "text/json", output);
       });
       server.on("/set_brightness", HTTP_POST, [](AsyncWebServerRequest* request)
       {
-        File br = LittleFS.open("/brightness", "w");
-        if(!br)
-        {
-          request->send(500, "plain/text", "Failed to save brightness.");
-          return;
-        }
-        if(br.write(request->arg("brightness").c_str()) != request->arg("brightness").length())
-        {
-          request->send(500, "plain/text", "Failed to save brightness.");
-          return;
-        }
-        br.close();
-        pixelbox::ws2812b_8x8::set_brightness_percent(request->arg("brightness").toInt());
+        //only RAM is updated here, the settings file is written later, coalescing the slider's fast changes
+        pixelbox::settings::set_brightness(request->arg("brightness").toInt());
+        pixelbox::ws2812b_8x8::set_brightness_percent(pixelbox::settings::get().brightness);
         request->send(200);
       });
       server.on("/set_max_current", HTTP_POST, [](AsyncWebServerRequest* request)
       {
-        File br = LittleFS.open("/max_current", "w");
-        if(!br)
-        {
-          request->send(500, "plain/text", "Failed to save max current.");
-          return;
-        }
-        if(br.write(request->arg("max_current").c_str()) != request->arg("max_current").length())
-        {
-          request->send(500, "plain/text", "Failed to save max current.");
-          return;
-        }
-        br.close();
-        pixelbox::ws2812b_8x8::set_max_current(request->arg("max_current").toInt());
+        pixelbox::settings::set_max_current(request->arg("max_current").toInt());
+        pixelbox::ws2812b_8x8::set_max_current(pixelbox::settings::get().max_current);
         request->send(200);
       });
+      pixelbox::events::setup(server);
+      pixelbox::mirror::setup(server);
       server.begin();
     }
   }
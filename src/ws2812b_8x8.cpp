@@ -4,20 +4,32 @@
 #include <arduino-timer.h>
 #include "anim.hpp"
 #include "Hash.h"
+#ifdef WS_OUTPUT_UART
+#include "ws2812b_uart.hpp"
+static_assert(WS_DATA_PIN == 2, "UART output backend can only drive GPIO2 (UART1 TX)");
+#endif
 
 namespace pixelbox
 {
   namespace ws2812b_8x8
   {
-    CRGB out[WS_LED_NUM];             //framebuffer, FastLED will display this
+    CRGB frame[WS_LED_NUM];           //framebuffer in image (logical) pixel order
+    CRGB out[WS_LED_NUM];             //framebuffer in LED order, FastLED will display this
     bool on = true;                   //enable/disable display
     anim::animation_s* anim = NULL;   //pointer of animation to be displayed
+    uint8_t brightness = 64;          //requested brightness, may be lowered by the current limit
+    uint32_t max_current_ma = 0;      //current limit, 0 means no limit set
+    uint32_t out_current_ma = 0;      //estimated current of the framebuffer at full brightness
+    bool show_pending = false;        //output backend was busy, show the framebuffer as soon as possible
+    frame_cb committed_cb = NULL;     //observer of the committed frames (e.g. the web mirror)
 
     Timer timer = Timer<1, millis>(); //ms timer for rendering
 
     //locally used funcs
     bool render(void* data);
     void render_next_anim_frame();
+    void commit();
+    void show();
 
     void set(CRGB *in)
     {
@@ -25,15 +37,44 @@ namespace pixelbox
       ws2812b_8x8::anim = NULL;
       timer.cancel();
       timer.every(33, render);
-      memcpy(out, in, WS_LED_NUM * 3);
-      FastLED.show();
+      memcpy(frame, in, WS_LED_NUM * 3);
+      out_current_ma = anim::estimate_current(frame, WS_LED_NUM);
+      commit();
+      show();
+    }
+
+    void set(const CRGB* in, uint16_t width, uint16_t height, bool mapped)
+    {
+      if(in == NULL) return;
+      ws2812b_8x8::anim = NULL;
+      timer.cancel();
+      timer.every(33, render);
+
+      //center the image on the display, crop what doesn't fit
+      fill_solid(frame, WS_LED_NUM, CRGB::Black);
+      int32_t offset_x = ((int32_t)WS_LED_WIDTH - width) / 2;
+      int32_t offset_y = ((int32_t)WS_LED_HEIGHT - height) / 2;
+      for(int32_t y = 0; y < height; y++)
+      {
+        if(y + offset_y < 0 || y + offset_y >= WS_LED_HEIGHT) continue;
+        for(int32_t x = 0; x < width; x++)
+        {
+          if(x + offset_x < 0 || x + offset_x >= WS_LED_WIDTH) continue;
+          if(mapped) memcpy_P(&frame[(y + offset_y) * WS_LED_WIDTH + x + offset_x], &in[y * width + x], sizeof(CRGB));
+          else frame[(y + offset_y) * WS_LED_WIDTH + x + offset_x] = in[y * width + x];
+        }
+      }
+
+      out_current_ma = anim::estimate_current(frame, WS_LED_NUM);
+      commit();
+      show();
     }
 
     void set(anim::animation_s* anim)
     {
       ws2812b_8x8::anim = anim;
       render_next_anim_frame();
-      FastLED.show();
+      show();
     }
 
     void set_color(CRGB color)
@@ -41,25 +82,27 @@ namespace pixelbox
       ws2812b_8x8::anim = NULL;
       timer.cancel();
       timer.every(33, render);
-      fill_solid(out, WS_LED_NUM, color);
-      FastLED.show();
+      fill_solid(frame, WS_LED_NUM, color);
+      out_current_ma = anim::estimate_current(frame, WS_LED_NUM);
+      commit();
+      show();
     }
 
     void set_brightness(uint8_t value)
     {
-      FastLED.setBrightness(value);
+      brightness = value;
     }
 
     void set_brightness_percent(uint8_t percent)
     {
       if(percent > 100) percent = 100;
-      FastLED.setBrightness(percent * 255 / 100);
+      brightness = percent * 255 / 100;
     }
 
     void set_max_current(uint32 current_ma)
     {
       if(current_ma > 3000) current_ma = 3000;
-      FastLED.setMaxPowerInVoltsAndMilliamps(5, current_ma);
+      max_current_ma = current_ma;
     }
 
     void set_enable(bool on)
@@ -68,11 +111,67 @@ namespace pixelbox
       if(!on)
       {
         ws2812b_8x8::anim = NULL;
-        fill_solid(out, WS_LED_NUM, CRGB::Black);
-        FastLED.show();
+        fill_solid(frame, WS_LED_NUM, CRGB::Black);
+        out_current_ma = anim::estimate_current(frame, WS_LED_NUM);
+        commit();
+        show();
       }
     }
 
+    uint8_t limited_brightness(uint32_t current_ma)
+    {
+      //same scaling as FastLED's calculate_max_brightness_for_power_mW, but based on the cached estimate
+      if(max_current_ma == 0) return brightness;
+      uint32_t requested_ma = current_ma * brightness / 256;
+      if(requested_ma <= max_current_ma) return brightness;
+      return brightness * max_current_ma / requested_ma;
+    }
+
+    uint32_t predict_current(uint32_t current_ma)
+    {
+      return current_ma * limited_brightness(current_ma) / 256;
+    }
+
+    void get_current_estimate(uint32_t& peak_ma, uint32_t& avg_ma)
+    {
+      if(anim)
+      {
+        //predict every frame with its own limited brightness, like it will be displayed
+        anim::estimate_current(anim, peak_ma, avg_ma, predict_current);
+        return;
+      }
+
+      peak_ma = predict_current(out_current_ma);
+      avg_ma = peak_ma;
+    }
+
+    void commit()
+    {
+      //reorder the pixels to match the LED wiring, the mapping table is built at compile time
+      if(layout::identity)
+        memcpy(out, frame, WS_LED_NUM * 3);
+      else
+        for(uint32_t i = 0; i < WS_LED_NUM; i++) out[layout::map.index[i]] = frame[i];
+
+      if(committed_cb) committed_cb(frame);
+    }
+
+    void set_frame_cb(frame_cb callback)
+    {
+      committed_cb = callback;
+    }
+
+    void show()
+    {
+      //the framebuffer's estimate is updated on every commit, no need to scan it on every show
+#ifdef WS_OUTPUT_UART
+      show_pending = !ws2812b_uart::show((const uint8_t*)out, WS_LED_NUM, limited_brightness(out_current_ma));
+#else
+      FastLED.setBrightness(limited_brightness(out_current_ma));
+      FastLED.show();
+#endif
+    }
+
     void render_next_anim_frame()
     {
       if(!anim) return;
@@ -80,14 +179,17 @@ namespace pixelbox
       //loop the animation if reached the end
       if(anim->frame_index >= anim->frames_size) anim->frame_index = 0;
 
-      //set the timer at the next frame transition
+      //set the timer at the next frame transition (a still image is rendered at the usual 30 FPS)
       timer.cancel();
-      timer.every(anim->frames[anim->frame_index].delay_ms, render);
+      timer.every(anim->frames_size > 1 ? anim->frames[anim->frame_index].delay_ms : 33, render);
       
-      //overcopy protection & copy pixel data to the frambuffer
-      uint16_t pixels_to_copy = anim->frames[anim->frame_index].pixels_size;
+      //overcopy protection & copy pixel data to the frambuffer (mapped flash can only be read with 32 bit aligned loads)
+      uint32_t pixels_to_copy = anim->frames[anim->frame_index].pixels_size;
       if(pixels_to_copy > WS_LED_NUM) pixels_to_copy = WS_LED_NUM;
-      memcpy(out, anim->frames[anim->frame_index].pixels, pixels_to_copy * 3);
+      if(anim->frames[anim->frame_index].mapped) memcpy_P(frame, anim->frames[anim->frame_index].pixels, pixels_to_copy * 3);
+      else memcpy(frame, anim->frames[anim->frame_index].pixels, pixels_to_copy * 3);
+      out_current_ma = anim->frames[anim->frame_index].current_ma;
+      commit();
 
       //increment the frame index for next iteration
       anim->frame_index++;
@@ -96,22 +198,28 @@ namespace pixelbox
     bool render(void* data)
     {
       render_next_anim_frame(); //returns immediately if no animation is set
-      FastLED.show();
+      show();
       return true;
     }
 
     void setup()
     {
+#ifdef WS_OUTPUT_UART
+      ws2812b_uart::setup(WS_LED_NUM);
+#else
       FastLED.addLeds<WS2812B, WS_DATA_PIN, GRB>(out, WS_LED_NUM);
-      FastLED.setBrightness(64);
-      fill_solid(out, WS_LED_NUM, CHSV(0,0,0));
-      FastLED.show();
+#endif
+      fill_solid(frame, WS_LED_NUM, CHSV(0,0,0));
+      out_current_ma = anim::estimate_current(frame, WS_LED_NUM);
+      commit();
+      show();
       timer.every(33, render); //set the render timer @30 FPS
       anim = NULL;
     }
 
     void loop()
     {
+      if(show_pending) show();
       timer.tick();
     }
   };
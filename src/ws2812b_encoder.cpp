@@ -0,0 +1,45 @@
+#include "ws2812b_encoder.hpp"
+
+namespace pixelbox
+{
+  namespace ws2812b_encoder
+  {
+    //UART data bits (LSB first, inverted on the line) for two WS2812b bits, indexed by (first bit << 1) | second bit
+    //0 bit: 1 period high + 3 periods low, 1 bit: 3 periods high + 1 period low
+    const uint8_t symbols[4] =
+    {
+      0b110111, //0, 0
+      0b000111, //0, 1
+      0b110100, //1, 0
+      0b000100, //1, 1
+    };
+
+    //same as FastLED's scale8 (fixed version), 255 keeps the value
+    inline uint8_t scale(uint8_t value, uint8_t brightness)
+    {
+      return (uint8_t)(((uint16_t)value * (1 + (uint16_t)brightness)) >> 8);
+    }
+
+    void encode_byte(uint8_t value, uint8_t* out)
+    {
+      out[0] = symbols[(value >> 6) & 0x03];
+      out[1] = symbols[(value >> 4) & 0x03];
+      out[2] = symbols[(value >> 2) & 0x03];
+      out[3] = symbols[(value >> 0) & 0x03];
+    }
+
+    void encode(const uint8_t* rgb, uint32_t led_count, uint8_t brightness, uint8_t* out)
+    {
+      if(!rgb || !out) return;
+
+      for(uint32_t i = 0; i < led_count; i++)
+      {
+        //WS2812b expects GRB order
+        encode_byte(scale(rgb[3 * i + 1], brightness), out);
+        encode_byte(scale(rgb[3 * i + 0], brightness), out + WS_ENCODER_SYMBOLS_PER_BYTE);
+        encode_byte(scale(rgb[3 * i + 2], brightness), out + 2 * WS_ENCODER_SYMBOLS_PER_BYTE);
+        out += WS_ENCODER_SYMBOLS_PER_LED;
+      }
+    }
+  }
+}
@@ -0,0 +1,96 @@
+#ifdef WS_OUTPUT_UART //only built with the UART backend, keeps the interrupt handler out of IRAM otherwise
+
+#include "ws2812b_uart.hpp"
+
+#include <Arduino.h>
+#include <esp8266_peri.h>
+#include <ets_sys.h>
+
+#include "ws2812b_encoder.hpp"
+
+namespace pixelbox
+{
+  namespace ws2812b_uart
+  {
+    uint8_t* symbols = NULL;            //pre-encoded frame
+    uint32_t symbols_size = 0;          //size of the encoded frame
+    volatile uint32_t symbols_sent = 0; //symbols already pushed into the FIFO
+    uint32_t frame_started_us = 0;      //start of the actual frame, for the latch timing
+    uint32_t frame_time_us = 0;         //time of one frame on the line, including the latch
+
+    inline uint32_t fifo_count()
+    {
+      return (USS(1) >> USTXC) & 0xFF;
+    }
+
+    void IRAM_ATTR fill_fifo()
+    {
+      while(symbols_sent < symbols_size && fifo_count() < WS_UART_FIFO_SIZE)
+        USF(1) = symbols[symbols_sent++];
+    }
+
+    void IRAM_ATTR isr(void* arg, void* frame)
+    {
+      uint32_t status = USIS(1);
+      if(status & (1 << UIFE))
+      {
+        fill_fifo();
+        if(symbols_sent >= symbols_size) USIE(1) &= ~(1 << UIFE); //everything is in the FIFO, no more refill needed
+      }
+      USIC(1) = status;
+
+      //shared interrupt, clear UART0 as well not to get stuck in the interrupt
+      USIC(0) = USIS(0);
+    }
+
+    bool setup(uint32_t led_count)
+    {
+      symbols_size = ws2812b_encoder::encoded_size(led_count);
+      symbols = (uint8_t*)calloc(symbols_size, 1);
+      if(symbols == NULL)
+      {
+        symbols_size = 0;
+        return false;
+      }
+      symbols_sent = symbols_size;
+      frame_time_us = ws2812b_encoder::frame_time_us(led_count);
+
+      //3.2 Mbaud 6N1 on UART1 TX (GPIO2), inverted so the idle line is low
+      Serial1.begin(WS_ENCODER_BAUD, SERIAL_6N1, SERIAL_TX_ONLY);
+      USC0(1) |= (1 << UCTXI);
+
+      //FIFO empty interrupt below the threshold, enabled only while a frame is sent
+      USC1(1) = (WS_UART_FIFO_THRESHOLD << UCFET);
+      USIE(1) = 0;
+      USIC(1) = 0xFFFF;
+      ETS_UART_INTR_ATTACH(isr, NULL);
+      ETS_UART_INTR_ENABLE();
+      return true;
+    }
+
+    bool busy()
+    {
+      if(symbols_sent < symbols_size) return true;
+      return (micros() - frame_started_us) < frame_time_us;
+    }
+
+    bool show(const uint8_t* rgb, uint32_t led_count, uint8_t brightness)
+    {
+      if(symbols == NULL) return false;
+      if(ws2812b_encoder::encoded_size(led_count) != symbols_size) return false;
+      if(busy()) return false;
+
+      //the symbol buffer is not used by the interrupt any more, encode the new frame into it
+      ws2812b_encoder::encode(rgb, led_count, brightness, symbols);
+
+      //push the first FIFO worth of symbols, the interrupt does the rest
+      frame_started_us = micros();
+      symbols_sent = 0;
+      fill_fifo();
+      if(symbols_sent < symbols_size) USIE(1) |= (1 << UIFE);
+      return true;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,170 @@
+//host check of the asset region: maps the region file written by tools/assets/make_assets.py,
+//plays every asset through assets::load and compares it with its source image decoded by the parsers
+//run with: pio test -e native
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "assets.hpp"
+#include "png_parse.hpp"
+#include "gif_parse.hpp"
+
+using namespace pixelbox;
+
+//set by the pre script of the native environment
+#ifndef ASSETS_REGION_FILE
+#define ASSETS_REGION_FILE ".pio/build/native/assets_region.bin"
+#endif
+#ifndef ASSETS_SOURCE_DIR
+#define ASSETS_SOURCE_DIR "assets"
+#endif
+
+typedef struct source_frame_s
+{
+  uint32_t delay_ms;
+  std::vector<uint8_t> pixels; //RGB, full size
+} source_frame_s;
+
+void setUp() {}
+void tearDown() {}
+
+bool read_source(const std::string& path, std::vector<uint8_t>& data)
+{
+  FILE* f = fopen(path.c_str(), "rb");
+  if(f == NULL) return false;
+  uint8_t buf[4096];
+  size_t len;
+  while((len = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + len);
+  fclose(f);
+  return true;
+}
+
+//the asset's source image as the display shows it: full frames, GIF images drawn over the previous frame
+bool decode_source(const char* name, std::vector<source_frame_s>& frames, uint16_t& width, uint16_t& height)
+{
+  std::vector<uint8_t> data;
+  if(read_source(std::string(ASSETS_SOURCE_DIR) + "/" + name + ".png", data))
+  {
+    img_parse::png_parse_context_s ctx;
+    if(!img_parse::init(ctx, data.data(), data.size())) return false;
+    bool ok = img_parse::parse(ctx) && (ctx.pixel_size == 3 || ctx.pixel_size == 4);
+    if(ok)
+    {
+      width = ctx.hdr.width;
+      height = ctx.hdr.height;
+      source_frame_s frame;
+      frame.delay_ms = 0;
+      for(uint32_t i = 0; i < (uint32_t)width * height; i++)
+        frame.pixels.insert(frame.pixels.end(), ctx.unfiltered_data + i * ctx.pixel_size, ctx.unfiltered_data + i * ctx.pixel_size + 3);
+      frames.push_back(frame);
+    }
+    img_parse::deinit(ctx);
+    return ok;
+  }
+  if(read_source(std::string(ASSETS_SOURCE_DIR) + "/" + name + ".gif", data))
+  {
+    img_parse::gif_parse_context_s ctx;
+    if(img_parse::init(ctx, data.data(), data.size()) != img_parse::error_code_ok) return false;
+    bool ok = img_parse::parse(ctx) == img_parse::error_code_ok;
+    width = ctx.lsd.width;
+    height = ctx.lsd.height;
+    std::vector<uint8_t> canvas((uint32_t)width * height * 3, 0);
+    for(uint32_t i = 0; ok && i < ctx.images_size; i++)
+    {
+      img_parse::image_s& image = ctx.images[i];
+      if(ctx.images_size > 1 && !image.gce.valid) continue;
+      for(uint32_t y = 0; y < image.id.height; y++)
+      {
+        for(uint32_t x = 0; x < image.id.width; x++)
+        {
+          uint32_t cx = image.id.left_position + x, cy = image.id.top_position + y;
+          if(cx >= width || cy >= height || y * image.id.width + x >= image.output_size) continue;
+          memcpy(&canvas[(cy * width + cx) * 3], &image.output[y * image.id.width + x], 3);
+        }
+      }
+      source_frame_s frame;
+      frame.delay_ms = ctx.images_size > 1 ? image.gce.delay_time_10ms * 10 : 0;
+      frame.pixels = canvas;
+      frames.push_back(frame);
+    }
+    img_parse::deinit(ctx);
+    return ok && frames.size() > 0;
+  }
+  return false;
+}
+
+void test_map_file()
+{
+  assets::region_s region;
+  TEST_ASSERT_TRUE(assets::map_file(region, ASSETS_REGION_FILE));
+  TEST_ASSERT_TRUE(region.count > 0);
+
+  //same region as the one linked in
+  const assets::region_s& builtin = assets::builtin();
+  TEST_ASSERT_EQUAL_UINT32(builtin.size, region.size);
+  TEST_ASSERT_EQUAL_UINT32(builtin.count, region.count);
+  TEST_ASSERT_EQUAL_MEMORY(builtin.base, region.base, region.size);
+  assets::unmap(region);
+  TEST_ASSERT_NULL(region.base);
+}
+
+void test_map_file_invalid()
+{
+  assets::region_s region;
+  TEST_ASSERT_FALSE(assets::map_file(region, ASSETS_REGION_FILE ".missing"));
+  TEST_ASSERT_NULL(region.base);
+
+  //a file that isn't a region
+  TEST_ASSERT_FALSE(assets::map_file(region, ASSETS_SOURCE_DIR "/error.png"));
+  TEST_ASSERT_NULL(region.base);
+  TEST_ASSERT_EQUAL(-1, region.fd);
+}
+
+void test_play_assets()
+{
+  assets::region_s region;
+  TEST_ASSERT_TRUE(assets::map_file(region, ASSETS_REGION_FILE));
+
+  for(uint32_t index = 0; index < region.count; index++)
+  {
+    assets::asset_s asset;
+    TEST_ASSERT_TRUE(assets::get(region, index, asset));
+    TEST_ASSERT_EQUAL((int32_t)index, assets::find(region, asset.name));
+
+    std::vector<source_frame_s> source;
+    uint16_t width = 0, height = 0;
+    TEST_ASSERT_TRUE(decode_source(asset.name, source, width, height));
+    TEST_ASSERT_EQUAL_UINT32(width, asset.width);
+    TEST_ASSERT_EQUAL_UINT32(height, asset.height);
+
+    //played like the display does, frame by frame
+    anim::animation_s anim;
+    memset(&anim, 0, sizeof(anim));
+    TEST_ASSERT_TRUE(assets::load(region, index, &anim));
+    TEST_ASSERT_EQUAL_UINT32(source.size(), anim.frames_size);
+    for(anim.frame_index = 0; anim.frame_index < anim.frames_size; anim.frame_index++)
+    {
+      const anim::frame_s& frame = anim.frames[anim.frame_index];
+      const source_frame_s& expected = source[anim.frame_index];
+      TEST_ASSERT_TRUE(frame.mapped);
+      TEST_ASSERT_EQUAL_UINT32(expected.delay_ms, frame.delay_ms);
+      TEST_ASSERT_EQUAL_UINT32((uint32_t)width * height, frame.pixels_size);
+      TEST_ASSERT_EQUAL_MEMORY(expected.pixels.data(), frame.pixels, expected.pixels.size());
+      TEST_ASSERT_EQUAL_UINT32(anim::estimate_current((const CRGB*)expected.pixels.data(), frame.pixels_size), frame.current_ma);
+    }
+    anim::animation_init(&anim);
+  }
+  assets::unmap(region);
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_map_file);
+  RUN_TEST(test_map_file_invalid);
+  RUN_TEST(test_play_assets);
+  return UNITY_END();
+}
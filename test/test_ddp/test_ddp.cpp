@@ -0,0 +1,230 @@
+//host check of the DDP packet handling and the frame mailbox between the UDP callback and loop()
+//run with: pio test -e native
+
+#include <unity.h>
+#include <cstring>
+
+#include "ddp.hpp"
+#include "mailbox.hpp"
+
+using namespace pixelbox;
+
+#define FRAME_SIZE (8 * 8 * 3)
+
+void setUp() {}
+void tearDown() {}
+
+//DDP v1 packet for the display, RGB 8 bit, data bytes all set to value
+uint32_t make_packet(uint8_t* packet, uint8_t flags, uint8_t sequence, uint32_t offset, uint16_t length, uint8_t value)
+{
+  packet[0] = DDP_FLAG_VERSION_1 | flags;
+  packet[1] = sequence;
+  packet[2] = 0x0B; //RGB, 8 bit per channel
+  packet[3] = DDP_ID_DISPLAY;
+  packet[4] = offset >> 24;
+  packet[5] = offset >> 16;
+  packet[6] = offset >> 8;
+  packet[7] = offset;
+  packet[8] = length >> 8;
+  packet[9] = length;
+  uint32_t data_offset = DDP_HEADER_SIZE + (flags & DDP_FLAG_TIMECODE ? 4 : 0);
+  memset(packet + DDP_HEADER_SIZE, 0, data_offset - DDP_HEADER_SIZE);
+  memset(packet + data_offset, value, length);
+  return data_offset + length;
+}
+
+void test_parse_valid()
+{
+  uint8_t packet[DDP_HEADER_SIZE + 4 + FRAME_SIZE];
+  ddp::header_s header;
+  uint32_t len = make_packet(packet, DDP_FLAG_PUSH, 3, 6, 9, 0x42);
+  TEST_ASSERT_TRUE(ddp::parse(packet, len, header));
+  TEST_ASSERT_EQUAL_UINT32(3, header.sequence);
+  TEST_ASSERT_EQUAL_UINT32(6, header.offset);
+  TEST_ASSERT_EQUAL_UINT32(9, header.length);
+  TEST_ASSERT_TRUE(header.data == packet + DDP_HEADER_SIZE);
+
+  //the timecode sits between the header and the data
+  len = make_packet(packet, DDP_FLAG_TIMECODE, 0, 0, 3, 0x42);
+  TEST_ASSERT_TRUE(ddp::parse(packet, len, header));
+  TEST_ASSERT_TRUE(header.data == packet + DDP_HEADER_SIZE + 4);
+}
+
+void test_parse_invalid()
+{
+  uint8_t packet[DDP_HEADER_SIZE + 4 + FRAME_SIZE];
+  ddp::header_s header;
+
+  //version 2 and version 0
+  uint32_t len = make_packet(packet, 0, 0, 0, 3, 0);
+  packet[0] = 0x80;
+  TEST_ASSERT_FALSE(ddp::parse(packet, len, header));
+  packet[0] = 0x00;
+  TEST_ASSERT_FALSE(ddp::parse(packet, len, header));
+
+  //shorter than the header
+  len = make_packet(packet, 0, 0, 0, 3, 0);
+  TEST_ASSERT_FALSE(ddp::parse(packet, DDP_HEADER_SIZE - 1, header));
+  TEST_ASSERT_FALSE(ddp::parse(NULL, len, header));
+
+  //payload truncated: the length field claims more than the packet holds
+  TEST_ASSERT_FALSE(ddp::parse(packet, len - 1, header));
+
+  //the timecode flag without room for the timecode and the data
+  len = make_packet(packet, 0, 0, 0, 3, 0);
+  packet[0] |= DDP_FLAG_TIMECODE;
+  TEST_ASSERT_FALSE(ddp::parse(packet, len, header));
+}
+
+void test_receive_rejects()
+{
+  uint8_t packet[DDP_HEADER_SIZE + FRAME_SIZE];
+  uint8_t frame[FRAME_SIZE];
+  ddp::stats_s stats = {0, 0, 0, 0, 0};
+  memset(frame, 0, sizeof(frame));
+
+  uint32_t len = make_packet(packet, DDP_FLAG_PUSH, 0, 0, FRAME_SIZE, 0xFF);
+  packet[3] = 2; //another output device
+  TEST_ASSERT_FALSE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+
+  len = make_packet(packet, DDP_FLAG_QUERY, 0, 0, 0, 0);
+  TEST_ASSERT_FALSE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+
+  len = make_packet(packet, DDP_FLAG_PUSH, 0, 0, FRAME_SIZE, 0xFF);
+  packet[2] = 0x1B; //HSL
+  TEST_ASSERT_FALSE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+
+  len = make_packet(packet, DDP_FLAG_PUSH, 0, 0, FRAME_SIZE, 0xFF);
+  TEST_ASSERT_FALSE(ddp::receive(packet, len - 1, frame, FRAME_SIZE, stats));
+
+  TEST_ASSERT_EQUAL_UINT32(4, stats.packets);
+  TEST_ASSERT_EQUAL_UINT32(4, stats.invalid);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.frames);
+  for(uint32_t i = 0; i < FRAME_SIZE; i++) TEST_ASSERT_EQUAL_UINT8(0, frame[i]);
+}
+
+void test_receive_clipping()
+{
+  uint8_t packet[DDP_HEADER_SIZE + FRAME_SIZE];
+  uint8_t frame[FRAME_SIZE + 3]; //the last pixel is a guard past the frame
+  ddp::stats_s stats = {0, 0, 0, 0, 0};
+  memset(frame, 0, sizeof(frame));
+
+  //whole frame in one packet, complete without push
+  uint32_t len = make_packet(packet, 0, 0, 0, FRAME_SIZE, 0x11);
+  TEST_ASSERT_TRUE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+  TEST_ASSERT_EQUAL_UINT8(0x11, frame[FRAME_SIZE - 1]);
+
+  //offset past the end of the frame: valid, nothing copied
+  len = make_packet(packet, 0, 0, FRAME_SIZE + 30, 6, 0x22);
+  TEST_ASSERT_FALSE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+  for(uint32_t i = 0; i < FRAME_SIZE; i++) TEST_ASSERT_EQUAL_UINT8(0x11, frame[i]);
+  TEST_ASSERT_EQUAL_UINT8(0, frame[FRAME_SIZE]);
+
+  //data running over the end is cut at the frame size
+  len = make_packet(packet, DDP_FLAG_PUSH, 0, FRAME_SIZE - 3, 9, 0x33);
+  TEST_ASSERT_TRUE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+  TEST_ASSERT_EQUAL_UINT8(0x11, frame[FRAME_SIZE - 4]);
+  TEST_ASSERT_EQUAL_UINT8(0x33, frame[FRAME_SIZE - 1]);
+  TEST_ASSERT_EQUAL_UINT8(0, frame[FRAME_SIZE]);
+
+  TEST_ASSERT_EQUAL_UINT32(0, stats.invalid);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.frames);
+}
+
+void test_receive_sequence()
+{
+  uint8_t packet[DDP_HEADER_SIZE + FRAME_SIZE];
+  uint8_t frame[FRAME_SIZE];
+  ddp::stats_s stats = {0, 0, 0, 0, 0};
+
+  //14, 15, 1 is the wrap without gaps, then 4 misses 2 and 3
+  const uint8_t sequences[] = {14, 15, 1, 4};
+  for(uint8_t sequence : sequences)
+  {
+    uint32_t len = make_packet(packet, DDP_FLAG_PUSH, sequence, 0, FRAME_SIZE, sequence);
+    TEST_ASSERT_TRUE(ddp::receive(packet, len, frame, FRAME_SIZE, stats));
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, stats.lost);
+
+  //an other receiver starts without history, its first packet is no gap
+  ddp::stats_s other = {0, 0, 0, 0, 0};
+  uint32_t len = make_packet(packet, DDP_FLAG_PUSH, 9, 0, FRAME_SIZE, 9);
+  TEST_ASSERT_TRUE(ddp::receive(packet, len, frame, FRAME_SIZE, other));
+  TEST_ASSERT_EQUAL_UINT32(0, other.lost);
+  TEST_ASSERT_EQUAL_UINT32(4, stats.last_sequence);
+}
+
+void test_mailbox_order()
+{
+  static mailbox::mailbox_t<4> box;
+  TEST_ASSERT_NULL(box.take());
+
+  box.back_buffer()[0] = 1;
+  box.publish();
+  const uint8_t* frame = box.take();
+  TEST_ASSERT_NOT_NULL(frame);
+  TEST_ASSERT_EQUAL_UINT8(1, frame[0]);
+  TEST_ASSERT_NULL(box.take());
+
+  //two publishes before a take: the latest one wins, the other is dropped
+  box.back_buffer()[0] = 2;
+  box.publish();
+  box.back_buffer()[0] = 3;
+  box.publish();
+  frame = box.take();
+  TEST_ASSERT_NOT_NULL(frame);
+  TEST_ASSERT_EQUAL_UINT8(3, frame[0]);
+  TEST_ASSERT_NULL(box.take());
+  TEST_ASSERT_EQUAL_UINT32(3, box.published);
+  TEST_ASSERT_EQUAL_UINT32(1, box.dropped);
+
+  //the buffer being read by the consumer is never handed to the producer
+  for(uint8_t i = 4; i < 20; i++)
+  {
+    TEST_ASSERT_TRUE(box.back_buffer() != frame);
+    box.back_buffer()[0] = i;
+    box.publish();
+    if(i % 3 == 0)
+    {
+      frame = box.take();
+      TEST_ASSERT_EQUAL_UINT8(i, frame[0]);
+    }
+  }
+}
+
+void test_mailbox_partial_frames()
+{
+  //a DDP sender updating only the second pixel of a frame: with keep the rest of the last frame stays
+  static mailbox::mailbox_t<FRAME_SIZE> box;
+  uint8_t packet[DDP_HEADER_SIZE + FRAME_SIZE];
+  ddp::stats_s stats = {0, 0, 0, 0, 0};
+
+  for(uint8_t value = 1; value <= 3; value++)
+  {
+    uint32_t len = make_packet(packet, DDP_FLAG_PUSH, 0, 0, FRAME_SIZE, value);
+    TEST_ASSERT_TRUE(ddp::receive(packet, len, box.back_buffer(), FRAME_SIZE, stats));
+    box.publish(true);
+    box.take();
+  }
+  uint32_t len = make_packet(packet, DDP_FLAG_PUSH, 0, 3, 3, 0x7F);
+  TEST_ASSERT_TRUE(ddp::receive(packet, len, box.back_buffer(), FRAME_SIZE, stats));
+  box.publish(true);
+  const uint8_t* frame = box.take();
+  TEST_ASSERT_EQUAL_UINT8(3, frame[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x7F, frame[3]);
+  TEST_ASSERT_EQUAL_UINT8(3, frame[FRAME_SIZE - 1]);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_valid);
+  RUN_TEST(test_parse_invalid);
+  RUN_TEST(test_receive_rejects);
+  RUN_TEST(test_receive_clipping);
+  RUN_TEST(test_receive_sequence);
+  RUN_TEST(test_mailbox_order);
+  RUN_TEST(test_mailbox_partial_frames);
+  return UNITY_END();
+}
@@ -0,0 +1,106 @@
+//host check of the UART symbol encoding: the symbols are played back as the inverted 6N1 line signal
+//and the WS2812b bits are read back from the pulse widths
+//run with: pio test -e native
+
+#include <unity.h>
+#include <cstring>
+
+#include "ws2812b_encoder.hpp"
+
+using namespace pixelbox;
+
+void setUp() {}
+void tearDown() {}
+
+//line level of one UART symbol, 8 periods: start bit, 6 data bits LSB first, stop bit, all inverted
+void line_periods(uint8_t symbol, uint8_t periods[8])
+{
+  periods[0] = 1; //inverted start bit
+  for(uint32_t i = 0; i < 6; i++) periods[1 + i] = !((symbol >> i) & 0x01);
+  periods[7] = 0; //inverted stop bit
+}
+
+//WS2812b bits from the line, every bit is 4 periods: 1 high + 3 low is a 0, 3 high + 1 low is a 1
+//returns false on a pulse that is neither
+bool read_bits(const uint8_t* symbols, uint32_t symbols_size, uint8_t* bytes)
+{
+  memset(bytes, 0, symbols_size / 4);
+  for(uint32_t s = 0; s < symbols_size; s++)
+  {
+    uint8_t periods[8];
+    line_periods(symbols[s], periods);
+    for(uint32_t half = 0; half < 2; half++)
+    {
+      const uint8_t* p = periods + 4 * half;
+      bool bit;
+      if(p[0] && !p[1] && !p[2] && !p[3]) bit = false;
+      else if(p[0] && p[1] && p[2] && !p[3]) bit = true;
+      else return false;
+      uint32_t index = 2 * s + half; //bit index in the stream, MSB first
+      if(bit) bytes[index / 8] |= 0x80 >> (index % 8);
+    }
+  }
+  return true;
+}
+
+void test_symbol_size()
+{
+  TEST_ASSERT_EQUAL_UINT32(12, ws2812b_encoder::encoded_size(1));
+  TEST_ASSERT_EQUAL_UINT32(768, ws2812b_encoder::encoded_size(64));
+}
+
+void test_known_colors()
+{
+  //RGB in memory, GRB on the line
+  const uint8_t colors[][3] = {{0x00, 0x00, 0x00}, {0xFF, 0xFF, 0xFF}, {0xFF, 0x00, 0x00}, {0x00, 0xFF, 0x00}, {0x00, 0x00, 0xFF}, {0x12, 0x34, 0x56}, {0xA5, 0x5A, 0x81}};
+  const uint32_t count = sizeof(colors) / sizeof(colors[0]);
+  uint8_t symbols[ws2812b_encoder::encoded_size(count)];
+  ws2812b_encoder::encode(&colors[0][0], count, 255, symbols);
+
+  uint8_t bytes[count * 3];
+  TEST_ASSERT_TRUE(read_bits(symbols, sizeof(symbols), bytes));
+  for(uint32_t i = 0; i < count; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(colors[i][1], bytes[3 * i + 0]);
+    TEST_ASSERT_EQUAL_UINT8(colors[i][0], bytes[3 * i + 1]);
+    TEST_ASSERT_EQUAL_UINT8(colors[i][2], bytes[3 * i + 2]);
+  }
+}
+
+void test_every_byte()
+{
+  for(uint32_t value = 0; value < 256; value++)
+  {
+    uint8_t symbols[WS_ENCODER_SYMBOLS_PER_BYTE];
+    uint8_t byte;
+    ws2812b_encoder::encode_byte(value, symbols);
+    TEST_ASSERT_TRUE(read_bits(symbols, sizeof(symbols), &byte));
+    TEST_ASSERT_EQUAL_UINT8(value, byte);
+  }
+}
+
+void test_brightness()
+{
+  //scaled like FastLED's scale8: 255 keeps the value, 0 turns it off
+  const uint8_t white[3] = {0xFF, 0xFF, 0xFF};
+  uint8_t symbols[ws2812b_encoder::encoded_size(1)];
+  uint8_t bytes[3];
+
+  ws2812b_encoder::encode(white, 1, 128, symbols);
+  TEST_ASSERT_TRUE(read_bits(symbols, sizeof(symbols), bytes));
+  TEST_ASSERT_EQUAL_UINT8(128, bytes[0]);
+
+  ws2812b_encoder::encode(white, 1, 0, symbols);
+  TEST_ASSERT_TRUE(read_bits(symbols, sizeof(symbols), bytes));
+  TEST_ASSERT_EQUAL_UINT8(0, bytes[0]);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_symbol_size);
+  RUN_TEST(test_known_colors);
+  RUN_TEST(test_every_byte);
+  RUN_TEST(test_brightness);
+  return UNITY_END();
+}
@@ -0,0 +1,230 @@
+//host tool: decodes the PNG/GIF files of the assets folder with the firmware's own parsers
+//and generates src/assets_region.cpp, the built-in asset region linked into the flash (see assets.hpp),
+//and the same region as a binary file for the host, mapped with assets::map_file
+//usage: make_assets <output.cpp> <output.bin> <image files...>
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+#include <string>
+#include <vector>
+
+#include "png_parse.hpp"
+#include "gif_parse.hpp"
+#include "assets_format.hpp"
+#include "led_current.hpp"
+
+typedef struct frame_s
+{
+  uint32_t delay_ms;
+  std::vector<uint8_t> pixels; //RGB
+} frame_s;
+
+typedef struct asset_s
+{
+  std::string name;
+  uint16_t width;
+  uint16_t height;
+  std::vector<frame_s> frames;
+} asset_s;
+
+bool read_file(const char* path, std::vector<uint8_t>& data)
+{
+  FILE* f = fopen(path, "rb");
+  if(f == NULL) return false;
+  uint8_t buf[4096];
+  size_t len;
+  while((len = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + len);
+  fclose(f);
+  return true;
+}
+
+bool decode_png(std::vector<uint8_t>& data, asset_s& asset)
+{
+  img_parse::png_parse_context_s ctx;
+  if(!img_parse::init(ctx, data.data(), data.size())) return false;
+  bool ok = img_parse::parse(ctx) && (ctx.pixel_size == 3 || ctx.pixel_size == 4);
+  if(ok)
+  {
+    //drop the alpha channel if necessary, like the firmware does
+    asset.width = ctx.hdr.width;
+    asset.height = ctx.hdr.height;
+    frame_s frame;
+    frame.delay_ms = 0;
+    for(uint32_t i = 0; i < (uint32_t)asset.width * asset.height; i++)
+      frame.pixels.insert(frame.pixels.end(), ctx.unfiltered_data + i * ctx.pixel_size, ctx.unfiltered_data + i * ctx.pixel_size + 3);
+    asset.frames.push_back(frame);
+  }
+  img_parse::deinit(ctx);
+  return ok;
+}
+
+bool decode_gif(std::vector<uint8_t>& data, asset_s& asset)
+{
+  img_parse::gif_parse_context_s ctx;
+  if(img_parse::init(ctx, data.data(), data.size()) != img_parse::error_code_ok) return false;
+  bool ok = img_parse::parse(ctx) == img_parse::error_code_ok;
+  if(ok)
+  {
+    //frames are stored full size, every image is drawn over the previous frame at its position
+    asset.width = ctx.lsd.width;
+    asset.height = ctx.lsd.height;
+    std::vector<uint8_t> canvas(asset.width * asset.height * 3, 0);
+    for(uint32_t i = 0; i < ctx.images_size; i++)
+    {
+      img_parse::image_s& image = ctx.images[i];
+      if(ctx.images_size > 1 && !image.gce.valid) continue; //skip frames without gce, like the firmware does
+      for(uint32_t y = 0; y < image.id.height; y++)
+      {
+        for(uint32_t x = 0; x < image.id.width; x++)
+        {
+          uint32_t cx = image.id.left_position + x, cy = image.id.top_position + y;
+          if(cx >= asset.width || cy >= asset.height || y * image.id.width + x >= image.output_size) continue;
+          memcpy(&canvas[(cy * asset.width + cx) * 3], &image.output[y * image.id.width + x], 3);
+        }
+      }
+      frame_s frame;
+      frame.delay_ms = ctx.images_size > 1 ? image.gce.delay_time_10ms * 10 : 0;
+      frame.pixels = canvas;
+      asset.frames.push_back(frame);
+    }
+    ok = asset.frames.size() > 0;
+  }
+  img_parse::deinit(ctx);
+  return ok;
+}
+
+uint32_t estimate_current(const std::vector<uint8_t>& pixels)
+{
+  uint32_t red = 0, green = 0, blue = 0;
+  for(size_t i = 0; i + 2 < pixels.size(); i += 3)
+  {
+    red += pixels[i];
+    green += pixels[i + 1];
+    blue += pixels[i + 2];
+  }
+  return pixelbox::led_current::estimate(red, green, blue, pixels.size() / 3);
+}
+
+template<typename T> void put(std::vector<uint8_t>& out, const T& value)
+{
+  const uint8_t* bytes = (const uint8_t*)&value;
+  out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+std::vector<uint8_t> build_region(const std::vector<asset_s>& assets)
+{
+  //header, asset table, then the frames of every asset (the structs of assets_format.hpp, the host is little endian like the ESP8266)
+  std::vector<uint8_t> table, frames;
+  uint32_t frames_offset = sizeof(pixelbox::assets::header_s) + assets.size() * sizeof(pixelbox::assets::asset_s);
+  for(const asset_s& asset : assets)
+  {
+    pixelbox::assets::asset_s entry;
+    memset(&entry, 0, sizeof(entry));
+    strncpy(entry.name, asset.name.c_str(), ASSETS_NAME_MAX - 1);
+    entry.width = asset.width;
+    entry.height = asset.height;
+    entry.frames = asset.frames.size();
+    entry.offset = frames_offset + frames.size();
+    put(table, entry);
+
+    for(const frame_s& frame : asset.frames)
+    {
+      pixelbox::assets::frame_header_s header = {frame.delay_ms, estimate_current(frame.pixels)};
+      put(frames, header);
+      frames.insert(frames.end(), frame.pixels.begin(), frame.pixels.end());
+      while(frames.size() % 4) frames.push_back(0); //padding
+    }
+  }
+
+  pixelbox::assets::header_s header = {ASSETS_MAGIC, (uint32_t)assets.size(), (uint32_t)(frames_offset + frames.size())};
+  std::vector<uint8_t> region;
+  put(region, header);
+  region.insert(region.end(), table.begin(), table.end());
+  region.insert(region.end(), frames.begin(), frames.end());
+  return region;
+}
+
+bool write_source(const char* path, const std::vector<asset_s>& assets, const std::vector<uint8_t>& region)
+{
+  FILE* f = fopen(path, "w");
+  if(f == NULL) return false;
+  fprintf(f, "//generated by tools/assets/make_assets.py from the assets folder, don't edit\n");
+  fprintf(f, "#include \"assets.hpp\"\n\n#ifdef ARDUINO\n#include <pgmspace.h>\n#endif\n\n");
+  fprintf(f, "namespace pixelbox\n{\n  namespace assets\n  {\n");
+  fprintf(f, "    //built-in assets:");
+  for(size_t i = 0; i < assets.size(); i++) fprintf(f, "%s %s (%ux%u, %u frames)", i ? "," : "", assets[i].name.c_str(), assets[i].width, assets[i].height, (uint32_t)assets[i].frames.size());
+  if(assets.empty()) fprintf(f, " none");
+  fprintf(f, "\n    //aligned for the 32 bit loads of mapped flash\n");
+  fprintf(f, "    extern const uint8_t region_data[] PROGMEM __attribute__((aligned(4))) = {\n");
+  for(size_t i = 0; i < region.size(); i += 16)
+  {
+    fprintf(f, "     ");
+    for(size_t j = i; j < i + 16 && j < region.size(); j++) fprintf(f, " 0x%02X,", region[j]);
+    fprintf(f, "\n");
+  }
+  fprintf(f, "    };\n  }\n}\n");
+  return fclose(f) == 0;
+}
+
+bool write_binary(const char* path, const std::vector<uint8_t>& region)
+{
+  FILE* f = fopen(path, "wb");
+  if(f == NULL) return false;
+  bool ok = fwrite(region.data(), 1, region.size(), f) == region.size();
+  return fclose(f) == 0 && ok;
+}
+
+int main(int argc, char** argv)
+{
+  if(argc < 3)
+  {
+    fprintf(stderr, "usage: %s <output.cpp> <output.bin> <image files...>\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<asset_s> assets;
+  for(int i = 3; i < argc; i++)
+  {
+    //the asset is named after the file, without folder and extension
+    std::string path = argv[i];
+    std::string name = path.substr(path.find_last_of("/\\") + 1);
+    std::string extension = name.find('.') != std::string::npos ? name.substr(name.find_last_of('.')) : "";
+    name = name.substr(0, name.find_last_of('.'));
+    if(name.length() >= ASSETS_NAME_MAX)
+    {
+      fprintf(stderr, "%s: name too long\n", path.c_str());
+      return 1;
+    }
+
+    std::vector<uint8_t> data;
+    asset_s asset;
+    asset.name = name;
+    bool ok = read_file(path.c_str(), data);
+    if(ok && extension == ".png") ok = decode_png(data, asset);
+    else if(ok && extension == ".gif") ok = decode_gif(data, asset);
+    else ok = false;
+    if(!ok)
+    {
+      fprintf(stderr, "%s: can't decode\n", path.c_str());
+      return 1;
+    }
+    printf("%s: %ux%u, %u frames\n", name.c_str(), asset.width, asset.height, (uint32_t)asset.frames.size());
+    assets.push_back(asset);
+  }
+
+  std::vector<uint8_t> region = build_region(assets);
+  if(!write_source(argv[1], assets, region))
+  {
+    fprintf(stderr, "%s: can't write\n", argv[1]);
+    return 1;
+  }
+  if(!write_binary(argv[2], region))
+  {
+    fprintf(stderr, "%s: can't write\n", argv[2]);
+    return 1;
+  }
+  printf("%s: %u bytes\n", argv[1], (uint32_t)region.size());
+  return 0;
+}
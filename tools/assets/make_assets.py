@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+#builds the host tool and regenerates src/assets_region.cpp from the images in the assets folder
+#the same region is written as a binary file into the build folder, the host checks (test/test_assets) map it
+#runs standalone or as a PlatformIO pre script (extra_scripts = pre:tools/assets/make_assets.py)
+#without a host compiler the committed src/assets_region.cpp is kept
+
+import os
+import shutil
+import subprocess
+import tempfile
+
+try:
+  Import('env')
+  dir_project = env.subst('$PROJECT_DIR')
+  dir_output = env.subst('$BUILD_DIR')
+except NameError:
+  env = None
+  dir_project = os.path.realpath(os.path.dirname(os.path.realpath(__file__))+'/../..')
+  dir_output = dir_project+'/.pio/build'
+
+dir_assets = dir_project+'/assets'
+file_output = dir_project+'/src/assets_region.cpp'
+file_region = dir_output+'/assets_region.bin'
+tool_sources = [dir_project+'/tools/assets/make_assets.cpp', dir_project+'/src/alloc.cpp', dir_project+'/src/png_parse.cpp', dir_project+'/src/gif_parse.cpp']
+tool_sources += [dir_project+'/lib/tinf/'+name for name in os.listdir(dir_project+'/lib/tinf') if name.endswith('.c')]
+tool_headers = [dir_project+'/include/assets_format.hpp', dir_project+'/include/led_current.hpp']
+
+def up_to_date(images):
+  if os.path.exists(file_output)==False or os.path.exists(file_region)==False:
+    return False
+  output_time = min(os.path.getmtime(file_output), os.path.getmtime(file_region))
+  return all(os.path.getmtime(path) < output_time for path in images+tool_sources+tool_headers)
+
+def generate():
+  images = []
+  if os.path.exists(dir_assets)==True:
+    images = sorted(dir_assets+'/'+name for name in os.listdir(dir_assets) if name.endswith('.png') or name.endswith('.gif'))
+  if up_to_date(images)==True:
+    return
+
+  compiler = shutil.which('g++') or shutil.which('c++')
+  if compiler==None:
+    print('make_assets: no host compiler, keeping '+file_output)
+    return
+
+  #the parsers are C++ but tinf is C, compile it as C++ as well
+  os.makedirs(dir_output, exist_ok=True)
+  with tempfile.TemporaryDirectory() as dir_build:
+    tool = dir_build+'/make_assets'
+    command = [compiler, '-std=gnu++17', '-O2', '-I'+dir_project+'/include', '-I'+dir_project+'/lib/tinf', '-x', 'c++'] + tool_sources + ['-o', tool]
+    subprocess.check_call(command)
+    subprocess.check_call([tool, file_output, file_region] + images)
+
+generate()
+
+#where the host checks find the region file and the source images
+if env!=None:
+  env.Append(CPPDEFINES=[('ASSETS_REGION_FILE', env.StringifyMacro(file_region)), ('ASSETS_SOURCE_DIR', env.StringifyMacro(dir_assets))])
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+#DDP test sender: streams frames to the Pixel Box at a given rate, then compares what was sent with the device's /realtime counters
+#usage: ddp_send.py <device address> [--fps 60] [--seconds 10] [--width 8] [--height 8]
+
+import argparse
+import colorsys
+import json
+import socket
+import time
+import urllib.request
+
+DDP_PORT = 4048
+DDP_FLAGS = 0x40 | 0x01  #version 1, push
+DDP_TYPE_RGB8 = 0x0B
+DDP_ID_DISPLAY = 1
+
+def device_stats(host):
+  with urllib.request.urlopen('http://' + host + '/realtime', timeout=5) as resp:
+    return json.loads(resp.read())
+
+def frame(width, height, t):
+  #moving rainbow
+  pixels = bytearray()
+  for y in range(height):
+    for x in range(width):
+      r, g, b = colorsys.hsv_to_rgb(((x + y) / (width + height) + t) % 1.0, 1.0, 1.0)
+      pixels += bytes((int(r * 255), int(g * 255), int(b * 255)))
+  return pixels
+
+def packet(sequence, data):
+  header = bytes((DDP_FLAGS, sequence, DDP_TYPE_RGB8, DDP_ID_DISPLAY, 0, 0, 0, 0, len(data) >> 8, len(data) & 0xFF))
+  return header + data
+
+parser = argparse.ArgumentParser()
+parser.add_argument('host')
+parser.add_argument('--fps', type=float, default=60)
+parser.add_argument('--seconds', type=float, default=10)
+parser.add_argument('--width', type=int, default=8)
+parser.add_argument('--height', type=int, default=8)
+args = parser.parse_args()
+
+before = device_stats(args.host)
+sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+sent = 0
+sequence = 1
+start = time.monotonic()
+while time.monotonic() - start < args.seconds:
+  sock.sendto(packet(sequence, frame(args.width, args.height, sent / 100)), (args.host, DDP_PORT))
+  sent += 1
+  sequence = sequence % 15 + 1
+  #pace the frames on the absolute schedule, so the rate doesn't drift
+  delay = start + sent / args.fps - time.monotonic()
+  if delay > 0: time.sleep(delay)
+elapsed = time.monotonic() - start
+
+time.sleep(0.5)
+after = device_stats(args.host)
+received = after['frames'] - before['frames']
+shown = after['shown'] - before['shown']
+print('sent:      %d frames, %.1f fps' % (sent, sent / elapsed))
+print('received:  %d frames (%d lost on the network)' % (received, sent - received))
+print('displayed: %d frames, %.1f fps (last second on the device: %d fps)' % (shown, shown / elapsed, after['fps']))
+print('dropped:   %d frames replaced before display, %d sequence gaps, %d invalid packets' % (after['dropped'] - before['dropped'], after['lost'] - before['lost'], after['invalid'] - before['invalid']))